@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <stack>
 #include <queue>
 #include <deque>
+#include <utility>
+#include "monoids.h"
 
 /**
  * Advanced Stack and Queue Applications
@@ -99,140 +105,415 @@ int largestRectangleArea(const std::vector<int>& heights) {
 }
 
 /**
- * Implement Stack using Two Queues
- * Push: O(n), Pop: O(1)
+ * Implement Stack using Queues
+ * The classic version enqueues into an empty queue and then rotates the
+ * other queue behind it, O(n) per push. Here the queue is a single
+ * power-of-two ring buffer: rotating all n older elements behind the new
+ * one is the same as writing the new element just before the current
+ * front, so push only moves the head index.
+ * Push: O(1) amortized, Pop: O(1)
  */
+template<typename T = int>
 class StackUsingQueues {
 private:
-    std::queue<int> q1, q2;
+    std::vector<T> ring;
+    size_t head;
+    size_t count;
+
+    void grow() {
+        std::vector<T> larger(ring.size() * 2);
+        for (size_t i = 0; i < count; i++) {
+            larger[i] = std::move(ring[(head + i) & (ring.size() - 1)]);
+        }
+        ring.swap(larger);
+        head = 0;
+    }
 
 public:
-    void push(int x) {
-        q2.push(x);
-        
-        // Move all elements from q1 to q2
-        while (!q1.empty()) {
-            q2.push(q1.front());
-            q1.pop();
+    StackUsingQueues() : ring(16), head(0), count(0) {}
+
+    void push(const T& x) {
+        if (count == ring.size()) {
+            grow();
         }
-        
-        // Swap q1 and q2
-        std::swap(q1, q2);
+        // Enqueue followed by a full rotation: x becomes the new front
+        head = (head - 1) & (ring.size() - 1);
+        ring[head] = x;
+        count++;
     }
     
-    int pop() {
-        if (q1.empty()) {
+    T pop() {
+        if (count == 0) {
             throw std::underflow_error("Stack is empty");
         }
         
-        int top = q1.front();
-        q1.pop();
+        T top = std::move(ring[head]);
+        head = (head + 1) & (ring.size() - 1);
+        count--;
         return top;
     }
     
-    int top() {
-        if (q1.empty()) {
+    T top() const {
+        if (count == 0) {
             throw std::underflow_error("Stack is empty");
         }
-        return q1.front();
+        return ring[head];
     }
     
-    bool empty() {
-        return q1.empty();
+    bool empty() const {
+        return count == 0;
+    }
+
+    int size() const {
+        return static_cast<int>(count);
     }
 };
 
 /**
  * Implement Queue using Two Stacks
- * Enqueue: O(1), Dequeue: O(n) worst case, O(1) amortized
+ * Both stacks live in one array: the inbox grows up from index 0 and the
+ * outbox grows down from the end, so no per-element allocation takes
+ * place. Transferring the inbox keeps its order (oldest element lands on
+ * top of the outbox) and is a single block move.
+ * Enqueue: O(1) amortized, Dequeue: O(1) amortized
  */
+template<typename T = int>
 class QueueUsingStacks {
 private:
-    std::stack<int> stack1, stack2;
+    std::vector<T> buffer;
+    size_t inboxSize;    // inbox occupies [0, inboxSize), newest at the end
+    size_t outboxTop;    // outbox occupies [outboxTop, capacity), top at outboxTop
 
-public:
-    void enqueue(int x) {
-        stack1.push(x);
+    void grow() {
+        size_t capacity = buffer.size();
+        size_t outboxSize = capacity - outboxTop;
+        std::vector<T> larger(capacity * 2);
+        std::move(buffer.begin(), buffer.begin() + inboxSize, larger.begin());
+        std::move(buffer.begin() + outboxTop, buffer.end(), larger.end() - outboxSize);
+        buffer.swap(larger);
+        outboxTop = buffer.size() - outboxSize;
     }
-    
-    int dequeue() {
-        if (stack2.empty()) {
-            // Move all elements from stack1 to stack2
-            while (!stack1.empty()) {
-                stack2.push(stack1.top());
-                stack1.pop();
+
+    // Shared by dequeue and front: refill the outbox when it runs dry
+    void transfer() {
+        if (outboxTop == buffer.size() && inboxSize > 0) {
+            outboxTop = buffer.size() - inboxSize;
+            if (outboxTop != 0) {
+                std::move_backward(buffer.begin(), buffer.begin() + inboxSize, buffer.end());
             }
+            inboxSize = 0;
         }
-        
-        if (stack2.empty()) {
-            throw std::underflow_error("Queue is empty");
+    }
+
+public:
+    QueueUsingStacks() : buffer(16), inboxSize(0), outboxTop(16) {}
+
+    void enqueue(const T& x) {
+        if (inboxSize == outboxTop) {
+            grow();
         }
-        
-        int front = stack2.top();
-        stack2.pop();
-        return front;
+        buffer[inboxSize++] = x;
     }
     
-    int front() {
-        if (stack2.empty()) {
-            while (!stack1.empty()) {
-                stack2.push(stack1.top());
-                stack1.pop();
-            }
+    T dequeue() {
+        transfer();
+        if (outboxTop == buffer.size()) {
+            throw std::underflow_error("Queue is empty");
         }
-        
-        if (stack2.empty()) {
+        return std::move(buffer[outboxTop++]);
+    }
+    
+    T front() {
+        transfer();
+        if (outboxTop == buffer.size()) {
             throw std::underflow_error("Queue is empty");
         }
-        
-        return stack2.top();
+        return buffer[outboxTop];
     }
     
-    bool empty() {
-        return stack1.empty() && stack2.empty();
+    bool empty() const {
+        return inboxSize == 0 && outboxTop == buffer.size();
+    }
+
+    int size() const {
+        return static_cast<int>(inboxSize + buffer.size() - outboxTop);
     }
 };
 
 /**
- * Min Stack - Stack with O(1) min operation
+ * Aggregating Stack - stack that reports min/max/sum/gcd (any monoid from
+ * monoids.h) of its contents in O(1)
+ *
+ * Compact mode (default) stores the running aggregate only when it changes,
+ * as (aggregate, count) runs: pushing values that leave the aggregate
+ * unchanged only bumps a counter. This suits min/max/gcd, whose aggregate
+ * changes rarely. Sum changes on almost every push, so Compact = false keeps
+ * one aggregate per element and skips the equality check.
  */
-class MinStack {
+template<typename T, typename Monoid = MinAgg<T>, bool Compact = true>
+class AggregatingStack {
+private:
+    struct Run {
+        T aggregate;
+        int count;
+    };
+
+    std::vector<T> values;
+    std::vector<Run> runs;
+    Monoid monoid;
+
+public:
+    explicit AggregatingStack(Monoid aggregator = Monoid()) : monoid(aggregator) {}
+
+    /**
+     * Push element and extend the running aggregate
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    void push(const T& val) {
+        T aggregate = runs.empty() ? val : monoid.combine(runs.back().aggregate, val);
+        values.push_back(val);
+
+        if (Compact && !runs.empty() && runs.back().aggregate == aggregate) {
+            runs.back().count++;
+        } else {
+            runs.push_back({aggregate, 1});
+        }
+    }
+
+    /**
+     * Pop top element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T pop() {
+        if (values.empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+        if (--runs.back().count == 0) {
+            runs.pop_back();
+        }
+        T top = std::move(values.back());
+        values.pop_back();
+        return top;
+    }
+
+    T top() const {
+        if (values.empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return values.back();
+    }
+
+    /**
+     * Aggregate of every element in the stack
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T aggregate() const {
+        if (values.empty()) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return runs.back().aggregate;
+    }
+
+    bool empty() const {
+        return values.empty();
+    }
+
+    int size() const {
+        return static_cast<int>(values.size());
+    }
+
+    /**
+     * Number of stored aggregate runs (memory overhead beyond the values)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int aggregateRuns() const {
+        return static_cast<int>(runs.size());
+    }
+};
+
+/**
+ * Difference-Encoded Extremum Stack - O(1) min (or max) in one int per
+ * element
+ *
+ * Each slot stores value - extremum-before-push. A slot that is "better"
+ * than zero under Compare marks a push that set a new extremum; popping it
+ * recovers the previous extremum as extremum - slot. The difference of two
+ * ints only fits in an int when they are less than 2^31 apart; the rare
+ * difference that does not is stored as long long on a side stack, with
+ * SPILLED left in its slot.
+ */
+template<typename Compare = std::less<long long>>
+class DifferenceEncodedStack {
 private:
-    std::stack<int> dataStack;
-    std::stack<int> minStack;
+    static constexpr int SPILLED = std::numeric_limits<int>::min();
+
+    std::vector<int> slots;
+    std::vector<long long> spilled;  // differences outside (INT_MIN, INT_MAX]
+    long long extremum;
+    Compare compare;
+
+    long long topDifference() const {
+        return slots.back() == SPILLED ? spilled.back() : slots.back();
+    }
 
 public:
+    DifferenceEncodedStack() : extremum(0) {}
+
+    /**
+     * Push element
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
     void push(int val) {
-        dataStack.push(val);
-        
-        if (minStack.empty() || val <= minStack.top()) {
-            minStack.push(val);
+        if (slots.empty()) {
+            slots.push_back(0);
+            extremum = val;
+            return;
+        }
+        long long difference = static_cast<long long>(val) - extremum;
+        if (difference > SPILLED && difference <= std::numeric_limits<int>::max()) {
+            slots.push_back(static_cast<int>(difference));
+        } else {
+            slots.push_back(SPILLED);
+            spilled.push_back(difference);
+        }
+        if (compare(difference, 0)) {
+            extremum = val;
         }
     }
-    
-    void pop() {
-        if (dataStack.empty()) {
+
+    /**
+     * Pop top element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int pop() {
+        if (slots.empty()) {
             throw std::underflow_error("Stack is empty");
         }
-        
-        if (dataStack.top() == minStack.top()) {
-            minStack.pop();
+        long long difference = topDifference();
+        if (slots.back() == SPILLED) {
+            spilled.pop_back();
+        }
+        slots.pop_back();
+
+        if (compare(difference, 0)) {
+            // This push set the extremum: it is the popped value
+            long long value = extremum;
+            extremum -= difference;
+            return static_cast<int>(value);
         }
-        dataStack.pop();
+        return static_cast<int>(extremum + difference);
     }
-    
-    int top() {
-        if (dataStack.empty()) {
+
+    int top() const {
+        if (slots.empty()) {
             throw std::underflow_error("Stack is empty");
         }
-        return dataStack.top();
+        long long difference = topDifference();
+        return static_cast<int>(compare(difference, 0) ? extremum : extremum + difference);
     }
-    
-    int getMin() {
-        if (minStack.empty()) {
+
+    /**
+     * Minimum (std::less) or maximum (std::greater) of the stack
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int extreme() const {
+        if (slots.empty()) {
             throw std::underflow_error("Stack is empty");
         }
-        return minStack.top();
+        return static_cast<int>(extremum);
+    }
+
+    bool empty() const {
+        return slots.empty();
+    }
+
+    int size() const {
+        return static_cast<int>(slots.size());
+    }
+
+    /**
+     * Number of differences too wide for an int (memory beyond the slots)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int spilledDifferences() const {
+        return static_cast<int>(spilled.size());
+    }
+};
+
+/**
+ * Min Stack - Stack with O(1) min operation
+ * Built on the difference-encoded stack, so tracking the minimum costs no
+ * memory beyond one int per element (plus a side entry for the rare push
+ * more than 2^31 away from the current minimum).
+ */
+class MinStack {
+private:
+    DifferenceEncodedStack<std::less<long long>> stack;
+
+public:
+    void push(int val) {
+        stack.push(val);
+    }
+    
+    void pop() {
+        stack.pop();
+    }
+    
+    int top() {
+        return stack.top();
+    }
+    
+    int getMin() {
+        return stack.extreme();
+    }
+
+    bool empty() const {
+        return stack.empty();
+    }
+
+    int size() const {
+        return stack.size();
+    }
+};
+
+/**
+ * Max Stack - Stack with O(1) max operation
+ */
+class MaxStack {
+private:
+    DifferenceEncodedStack<std::greater<long long>> stack;
+
+public:
+    void push(int val) {
+        stack.push(val);
+    }
+
+    void pop() {
+        stack.pop();
+    }
+
+    int top() {
+        return stack.top();
+    }
+
+    int getMax() {
+        return stack.extreme();
+    }
+
+    bool empty() const {
+        return stack.empty();
+    }
+
+    int size() const {
+        return stack.size();
     }
 };
 
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * Packed Binary Labels
+ * generateBinaryNumbers pushes std::string objects through a queue and
+ * builds every label by concatenation, allocating once or twice per number.
+ * PackedBinaryNumbers writes the binary representations of 1..n back to
+ * back into one char buffer, with an offsets array marking where each label
+ * starts. Labels are read through std::string_view, so nothing is copied.
+ *
+ * The layout is known in closed form: there are 2^(L-1) numbers of bit
+ * length L, so the offset of any v can be computed directly. That lets the
+ * parallel mode hand each thread an independent range of numbers and
+ * buffer positions with no coordination.
+ */
+
+class PackedBinaryNumbers {
+private:
+    std::vector<char> buffer;
+    std::vector<size_t> offsets;  // offsets[i] = start of the label for i + 1; offsets[n] = total length
+
+    // Eight-character renderings of every byte value, most significant bit first
+    struct ByteTable {
+        char digits[256][8];
+
+        ByteTable() {
+            for (int value = 0; value < 256; value++) {
+                for (int bit = 0; bit < 8; bit++) {
+                    digits[value][bit] = static_cast<char>('0' + ((value >> (7 - bit)) & 1));
+                }
+            }
+        }
+    };
+
+    static const ByteTable& byteTable() {
+        static const ByteTable table;
+        return table;
+    }
+
+    static int bitLength(uint64_t value) {
+        return 64 - __builtin_clzll(value);
+    }
+
+    /**
+     * Write the binary digits of value (bitLength(value) chars) to out
+     * Time Complexity: O(bitLength / 8)
+     * Space Complexity: O(1)
+     */
+    static void writeDigits(uint64_t value, int length, char* out) {
+        const ByteTable& table = byteTable();
+
+        // Leading partial byte, then whole bytes eight digits at a time
+        int partial = length % 8;
+        int shift = length - partial;
+        if (partial != 0) {
+            uint64_t top = value >> shift;
+            std::memcpy(out, table.digits[top] + (8 - partial), partial);
+            out += partial;
+        }
+        while (shift > 0) {
+            shift -= 8;
+            std::memcpy(out, table.digits[(value >> shift) & 0xFF], 8);
+            out += 8;
+        }
+    }
+
+    /**
+     * Fill labels for the numbers in [first, last)
+     * Time Complexity: O((last - first) * log n / 8)
+     * Space Complexity: O(1)
+     */
+    void fillRange(uint64_t first, uint64_t last) {
+        size_t position = offsetOf(first);
+        for (uint64_t value = first; value < last; value++) {
+            int length = bitLength(value);
+            offsets[value - 1] = position;
+            writeDigits(value, length, buffer.data() + position);
+            position += length;
+        }
+    }
+
+public:
+    /**
+     * Total characters used by the labels of 1..value-1
+     * Time Complexity: O(log value)
+     * Space Complexity: O(1)
+     */
+    static size_t offsetOf(uint64_t value) {
+        if (value <= 1) {
+            return 0;
+        }
+        int length = bitLength(value);
+        size_t offset = 0;
+        for (int l = 1; l < length; l++) {
+            offset += static_cast<size_t>(l) << (l - 1);
+        }
+        return offset + static_cast<size_t>(value - (1ULL << (length - 1))) * length;
+    }
+
+    class Iterator {
+    private:
+        const PackedBinaryNumbers* labels;
+        int index;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        Iterator(const PackedBinaryNumbers* owner, int position) : labels(owner), index(position) {}
+
+        std::string_view operator*() const {
+            return (*labels)[index];
+        }
+
+        Iterator& operator++() {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            index++;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return index == other.index && labels == other.labels;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Constructor - Generate binary labels for 1..n
+     * threads = 0 uses hardware_concurrency; ranges are split evenly.
+     * Time Complexity: O(n log n / (8 * threads))
+     * Space Complexity: O(n log n) characters plus n + 1 offsets
+     */
+    explicit PackedBinaryNumbers(int n, int threads = 1) {
+        if (n <= 0) {
+            offsets.assign(1, 0);
+            return;
+        }
+        if (threads <= 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        threads = std::min(threads, n);
+
+        uint64_t count = static_cast<uint64_t>(n);
+        buffer.resize(offsetOf(count + 1));
+        offsets.resize(count + 1);
+        offsets[count] = buffer.size();
+
+        if (threads == 1) {
+            fillRange(1, count + 1);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        uint64_t chunk = (count + threads - 1) / threads;
+        for (int t = 0; t < threads; t++) {
+            uint64_t first = 1 + t * chunk;
+            uint64_t last = std::min(count + 1, first + chunk);
+            if (first < last) {
+                workers.emplace_back([this, first, last]() { fillRange(first, last); });
+            }
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Label of the number index + 1
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    std::string_view operator[](int index) const {
+        return std::string_view(buffer.data() + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+
+    std::string_view at(int index) const {
+        if (index < 0 || index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    Iterator begin() const {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() const {
+        return Iterator(this, size());
+    }
+
+    int size() const {
+        return static_cast<int>(offsets.size() - 1);
+    }
+
+    /**
+     * Contiguous character data and its length (no separators)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    const char* data() const {
+        return buffer.data();
+    }
+
+    size_t bytes() const {
+        return buffer.size();
+    }
+};
@@ -0,0 +1,343 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Chunked Bracket-Balance Checker
+ * isBalanced pushes every opening bracket onto a Stack<char>, which costs one
+ * heap-backed push per opener and one branchy test per input byte. For
+ * multi-megabyte payloads BracketChecker instead:
+ *   - classifies 16 bytes at a time with SSE2 and only visits the bracket
+ *     bytes (scalar table lookup when SSE2 is unavailable),
+ *   - reduces each chunk to a summary of its unmatched closers and unmatched
+ *     openers, stored as runs of the same bracket type,
+ *   - combines summaries left to right; the combination is associative, so
+ *     chunks can be summarized on separate threads.
+ *
+ * Because brackets are stored as runs, an input that uses a single bracket
+ * type never holds more than one run: the checker degenerates to the
+ * classic O(1)-memory depth counter.
+ *
+ * Positions follow findUnbalancedPosition: index of the first closer that
+ * cannot be matched, total length if openers are left unclosed, -1 if
+ * balanced.
+ */
+
+class BracketChecker {
+public:
+    static constexpr size_t PARALLEL_THRESHOLD = 1 << 20;
+
+    struct Run {
+        char bracket;  // opening character of the bracket type
+        long long count;
+    };
+
+    struct ChunkSummary {
+        std::vector<Run> closes;  // unmatched closers, in input order
+        std::vector<Run> opens;   // unmatched openers, bottom to top
+        long long errorPosition;  // first closer that mismatched an opener inside the chunk
+    };
+
+private:
+    std::vector<Run> openStack;
+    long long offset;
+    long long errorPosition;
+
+    // 1..3 for openers, -1..-3 for closers, 0 otherwise
+    static int classify(char ch) {
+        switch (ch) {
+            case '(': return 1;
+            case '[': return 2;
+            case '{': return 3;
+            case ')': return -1;
+            case ']': return -2;
+            case '}': return -3;
+            default: return 0;
+        }
+    }
+
+    static char opener(int code) {
+        static const char OPENERS[] = {0, '(', '[', '{'};
+        return OPENERS[code < 0 ? -code : code];
+    }
+
+    static void pushRun(std::vector<Run>& runs, char bracket, long long count) {
+        if (!runs.empty() && runs.back().bracket == bracket) {
+            runs.back().count += count;
+        } else {
+            runs.push_back({bracket, count});
+        }
+    }
+
+    /**
+     * Call visit(index, code) for every bracket byte until it returns false
+     * Time Complexity: O(n / 16 + brackets) with SSE2, O(n) otherwise
+     * Space Complexity: O(1)
+     */
+    template<typename Visitor>
+    static void forEachBracket(const char* data, size_t length, Visitor visit) {
+        size_t i = 0;
+#ifdef __SSE2__
+        // '(' / ')' differ only in bit 0; '[' / '{' and ']' / '}' only in bit 5
+        const __m128i parenMask = _mm_set1_epi8(static_cast<char>(0xFE));
+        const __m128i parens = _mm_set1_epi8('(');
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        const __m128i curlyOpen = _mm_set1_epi8('{');
+        const __m128i curlyClose = _mm_set1_epi8('}');
+
+        for (; i + 16 <= length; i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i folded = _mm_or_si128(block, caseBit);
+            __m128i hits = _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_and_si128(block, parenMask), parens),
+                _mm_or_si128(_mm_cmpeq_epi8(folded, curlyOpen), _mm_cmpeq_epi8(folded, curlyClose)));
+
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+            while (mask != 0) {
+                size_t index = i + __builtin_ctz(mask);
+                if (!visit(index, classify(data[index]))) {
+                    return;
+                }
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; i < length; i++) {
+            int code = classify(data[i]);
+            if (code != 0 && !visit(i, code)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Position of the k-th (1-based) unmatched closer in a chunk
+     * Time Complexity: O(chunk length)
+     * Space Complexity: O(runs)
+     */
+    static long long locateUnmatchedClose(const char* data, size_t length, long long base, long long k) {
+        std::vector<Run> opens;
+        long long seen = 0;
+        long long position = -1;
+
+        forEachBracket(data, length, [&](size_t index, int code) {
+            if (code > 0) {
+                pushRun(opens, opener(code), 1);
+            } else if (!opens.empty()) {
+                // Matched inside the chunk (summaries stop at the first internal mismatch)
+                if (--opens.back().count == 0) {
+                    opens.pop_back();
+                }
+            } else if (++seen == k) {
+                position = base + static_cast<long long>(index);
+                return false;
+            }
+            return true;
+        });
+        return position;
+    }
+
+    /**
+     * Fold one chunk summary into the running open stack
+     * Time Complexity: O(runs in summary + runs consumed from the stack), plus a
+     *                  rescan of the chunk if it contains the first error
+     * Space Complexity: O(1) beyond the stack
+     */
+    void apply(const ChunkSummary& summary, const char* data, size_t length) {
+        long long matched = 0;
+        for (const Run& run : summary.closes) {
+            long long remaining = run.count;
+            while (remaining > 0) {
+                if (openStack.empty() || openStack.back().bracket != run.bracket) {
+                    errorPosition = locateUnmatchedClose(data, length, offset, matched + 1);
+                    return;
+                }
+                long long take = std::min(remaining, openStack.back().count);
+                openStack.back().count -= take;
+                if (openStack.back().count == 0) {
+                    openStack.pop_back();
+                }
+                remaining -= take;
+                matched += take;
+            }
+        }
+
+        if (summary.errorPosition != -1) {
+            errorPosition = summary.errorPosition;
+            return;
+        }
+        for (const Run& run : summary.opens) {
+            pushRun(openStack, run.bracket, run.count);
+        }
+    }
+
+public:
+    /**
+     * Constructor - Start an empty stream
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    BracketChecker() : offset(0), errorPosition(-1) {}
+
+    /**
+     * Reduce a chunk to its unmatched closers and openers
+     * base is the absolute position of data[0] in the full input.
+     * Time Complexity: O(n / 16 + brackets) with SSE2
+     * Space Complexity: O(runs)
+     */
+    static ChunkSummary summarize(const char* data, size_t length, long long base = 0) {
+        ChunkSummary summary;
+        summary.errorPosition = -1;
+
+        forEachBracket(data, length, [&](size_t index, int code) {
+            char bracket = opener(code);
+            if (code > 0) {
+                pushRun(summary.opens, bracket, 1);
+            } else if (summary.opens.empty()) {
+                pushRun(summary.closes, bracket, 1);
+            } else if (summary.opens.back().bracket == bracket) {
+                if (--summary.opens.back().count == 0) {
+                    summary.opens.pop_back();
+                }
+            } else {
+                summary.errorPosition = base + static_cast<long long>(index);
+                return false;
+            }
+            return true;
+        });
+        return summary;
+    }
+
+    /**
+     * Append the next piece of a stream
+     * Time Complexity: O(n / 16 + brackets) with SSE2
+     * Space Complexity: O(runs)
+     */
+    void feed(const char* data, size_t length) {
+        if (errorPosition == -1) {
+            apply(summarize(data, length, offset), data, length);
+        }
+        offset += static_cast<long long>(length);
+    }
+
+    void feed(const std::string& piece) {
+        feed(piece.data(), piece.size());
+    }
+
+    /**
+     * Append a piece whose summary was computed elsewhere (e.g. another thread)
+     * Time Complexity: O(runs)
+     * Space Complexity: O(runs)
+     */
+    void feed(const ChunkSummary& summary, const char* data, size_t length) {
+        if (errorPosition == -1) {
+            apply(summary, data, length);
+        }
+        offset += static_cast<long long>(length);
+    }
+
+    /**
+     * First error position for everything fed so far, treating the stream as complete
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    long long finish() const {
+        if (errorPosition != -1) {
+            return errorPosition;
+        }
+        return openStack.empty() ? -1 : offset;
+    }
+
+    /**
+     * Check whether a closer has already failed to match
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool hasError() const {
+        return errorPosition != -1;
+    }
+
+    /**
+     * Number of currently unclosed openers
+     * Time Complexity: O(runs)
+     * Space Complexity: O(1)
+     */
+    long long depth() const {
+        long long total = 0;
+        for (const Run& run : openStack) {
+            total += run.count;
+        }
+        return total;
+    }
+
+    /**
+     * Reset to an empty stream
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    void clear() {
+        openStack.clear();
+        offset = 0;
+        errorPosition = -1;
+    }
+};
+
+/**
+ * Find the first unbalanced position, summarizing chunks in parallel
+ * threads = 0 picks hardware_concurrency for inputs above
+ * BracketChecker::PARALLEL_THRESHOLD and a single thread otherwise.
+ * Time Complexity: O(n / threads + brackets)
+ * Space Complexity: O(threads * runs)
+ */
+long long findUnbalancedPositionParallel(const std::string& expression, int threads = 0) {
+    if (threads <= 0) {
+        threads = 1;
+        if (expression.size() >= BracketChecker::PARALLEL_THRESHOLD) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+    }
+    threads = static_cast<int>(std::min<size_t>(threads, std::max<size_t>(1, expression.size())));
+
+    BracketChecker checker;
+    if (threads == 1) {
+        checker.feed(expression);
+        return checker.finish();
+    }
+
+    size_t chunkSize = (expression.size() + threads - 1) / threads;
+    std::vector<BracketChecker::ChunkSummary> summaries(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            size_t begin = std::min(expression.size(), t * chunkSize);
+            size_t end = std::min(expression.size(), begin + chunkSize);
+            summaries[t] = BracketChecker::summarize(expression.data() + begin, end - begin,
+                                                     static_cast<long long>(begin));
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (int t = 0; t < threads && !checker.hasError(); t++) {
+        size_t begin = std::min(expression.size(), t * chunkSize);
+        size_t end = std::min(expression.size(), begin + chunkSize);
+        checker.feed(summaries[t], expression.data() + begin, end - begin);
+    }
+    return checker.finish();
+}
+
+/**
+ * Check balance with the chunked checker
+ * Time Complexity: O(n / threads + brackets)
+ * Space Complexity: O(threads * runs)
+ */
+bool isBalancedParallel(const std::string& expression, int threads = 0) {
+    return findUnbalancedPositionParallel(expression, threads) == -1;
+}
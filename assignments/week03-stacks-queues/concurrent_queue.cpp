@@ -0,0 +1,223 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * Bounded Multi-Producer / Multi-Consumer Queue
+ * Lock-free ring buffer in the style of Dmitry Vyukov's bounded MPMC queue.
+ *
+ * Every cell carries a sequence number that tells producers and consumers
+ * whether the cell is ready for them:
+ *   sequence == pos      -> cell is free, a producer may claim it
+ *   sequence == pos + 1  -> cell is full, a consumer may claim it
+ * Producers and consumers claim positions with a single CAS on their own
+ * counter, so enqueue and dequeue never contend with each other.
+ */
+
+template<typename T>
+class MPMCQueue {
+private:
+    static const int DEFAULT_CAPACITY = 1024;
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell* buffer;
+    size_t bufferMask;
+
+    // Keep the two counters on separate cache lines to avoid false sharing
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos;
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /**
+     * Back off after a failed attempt: spin briefly, then yield the CPU
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    static void backoff(int& attempt) {
+        if (attempt < 16) {
+            attempt++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+public:
+    /**
+     * Constructor - capacity is rounded up to the next power of two
+     * Time Complexity: O(capacity)
+     * Space Complexity: O(capacity)
+     */
+    MPMCQueue(int initialCapacity = DEFAULT_CAPACITY) {
+        if (initialCapacity <= 0) {
+            throw std::invalid_argument("Capacity must be positive");
+        }
+
+        size_t capacity = roundUpToPowerOfTwo(static_cast<size_t>(initialCapacity));
+        if (capacity < 2) {
+            capacity = 2;
+        }
+
+        buffer = new Cell[capacity];
+        bufferMask = capacity - 1;
+        for (size_t i = 0; i < capacity; i++) {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    // Shared between threads by reference; copying would break the protocol
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * Destructor - Clean up memory
+     * Time Complexity: O(capacity)
+     * Space Complexity: O(1)
+     */
+    ~MPMCQueue() {
+        delete[] buffer;
+    }
+
+    /**
+     * Try to add element to rear of queue without blocking
+     * Returns false if the queue is full
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    bool tryEnqueue(const T& element) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell* cell = &buffer[pos & bufferMask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Cell is free: try to claim this position
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell->data = element;
+                    cell->sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failure reloaded pos, retry
+            } else if (diff < 0) {
+                // Cell still holds an element from the previous lap: queue is full
+                return false;
+            } else {
+                // Another producer claimed this position, catch up
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Try to remove front element without blocking
+     * Returns false if the queue is empty
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    bool tryDequeue(T& result) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell* cell = &buffer[pos & bufferMask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                // Cell is full: try to claim this position
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    result = cell->data;
+                    // Mark the cell free for the producer one lap ahead
+                    cell->sequence.store(pos + bufferMask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // Producer has not filled this cell yet: queue is empty
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Add element to rear of queue, waiting while the queue is full
+     * Time Complexity: O(1) when space is available
+     * Space Complexity: O(1)
+     */
+    void enqueue(const T& element) {
+        int attempt = 0;
+        while (!tryEnqueue(element)) {
+            backoff(attempt);
+        }
+    }
+
+    /**
+     * Remove and return front element, waiting while the queue is empty
+     * Time Complexity: O(1) when an element is available
+     * Space Complexity: O(1)
+     */
+    T dequeue() {
+        T result;
+        int attempt = 0;
+        while (!tryDequeue(result)) {
+            backoff(attempt);
+        }
+        return result;
+    }
+
+    /**
+     * Get number of elements in queue
+     * Only a snapshot while other threads are running
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        size_t tail = enqueuePos.load(std::memory_order_acquire);
+        size_t head = dequeuePos.load(std::memory_order_acquire);
+        return tail > head ? static_cast<int>(tail - head) : 0;
+    }
+
+    /**
+     * Check if queue is empty (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Check if queue is full (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isFull() const {
+        return size() >= getCapacity();
+    }
+
+    /**
+     * Get fixed capacity of queue
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getCapacity() const {
+        return static_cast<int>(bufferMask + 1);
+    }
+};
@@ -0,0 +1,368 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * Lock-Free Stack (Treiber stack)
+ * LIFO data structure safe for any number of concurrent pushers and poppers.
+ *
+ * ABA protection: nodes live in a pool owned by the stack and are addressed
+ * by 32-bit indices. The head (and the internal free list) pack an index with
+ * a 32-bit modification tag into one 64-bit word, so a CAS fails whenever the
+ * head was popped and re-pushed in between, even if the index is the same.
+ * Because nodes are only recycled through the pool and never returned to the
+ * allocator while the stack is alive, reading a stale node is always safe.
+ *
+ * Under heavy contention a failed push/pop first tries to meet a partner in
+ * a small elimination array: a push and a pop that meet there cancel out
+ * without touching the head at all.
+ */
+
+template<typename T>
+class LockFreeStack {
+private:
+    static const uint32_t NIL = 0xFFFFFFFFu;
+    static const uint32_t FIRST_CHUNK_SIZE = 64;
+    static const int MAX_CHUNKS = 26;  // 64 * (2^26 - 1) nodes
+    static const int ELIMINATION_SLOTS = 8;
+    static const int ELIMINATION_SPINS = 64;
+    static const uint64_t EMPTY_SLOT = ~0ull;
+
+    struct Node {
+        T data;
+        std::atomic<uint32_t> next;
+    };
+
+    // Tagged pointer helpers: [ tag : 32 | index : 32 ]
+    static uint64_t pack(uint32_t index, uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+    static uint32_t indexOf(uint64_t word) {
+        return static_cast<uint32_t>(word);
+    }
+    static uint32_t tagOf(uint64_t word) {
+        return static_cast<uint32_t>(word >> 32);
+    }
+
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> freeHead;
+    std::atomic<int> count;
+
+    // Node pool: chunk k holds FIRST_CHUNK_SIZE << k nodes and never moves
+    std::atomic<Node*> chunks[MAX_CHUNKS];
+    std::atomic<uint32_t> nextFreshIndex;
+    std::mutex growMutex;
+
+    // Elimination array: each slot holds a tagged node index or EMPTY_SLOT
+    std::atomic<uint64_t> elimination[ELIMINATION_SLOTS];
+    std::atomic<uint32_t> eliminationTag;
+
+    /**
+     * Translate a node index into a pool address
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    Node* nodeAt(uint32_t index) const {
+        uint64_t shifted = static_cast<uint64_t>(index) / FIRST_CHUNK_SIZE + 1;
+        int chunk = 63 - __builtin_clzll(shifted);
+        uint64_t offset = index - (static_cast<uint64_t>(FIRST_CHUNK_SIZE) * ((1ull << chunk) - 1));
+        return &chunks[chunk].load(std::memory_order_acquire)[offset];
+    }
+
+    /**
+     * Make sure the chunk holding index exists
+     * Time Complexity: O(chunk size) on growth, O(1) otherwise
+     * Space Complexity: O(chunk size)
+     */
+    void ensureChunk(uint32_t index) {
+        uint64_t shifted = static_cast<uint64_t>(index) / FIRST_CHUNK_SIZE + 1;
+        int chunk = 63 - __builtin_clzll(shifted);
+        if (chunk >= MAX_CHUNKS) {
+            throw std::overflow_error("Stack node pool exhausted");
+        }
+        if (chunks[chunk].load(std::memory_order_acquire) == nullptr) {
+            std::lock_guard<std::mutex> lock(growMutex);
+            if (chunks[chunk].load(std::memory_order_relaxed) == nullptr) {
+                chunks[chunk].store(new Node[static_cast<size_t>(FIRST_CHUNK_SIZE) << chunk],
+                                    std::memory_order_release);
+            }
+        }
+    }
+
+    /**
+     * Pop a tagged index from a Treiber list (head or free list)
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    bool tryPopIndex(std::atomic<uint64_t>& list, uint32_t& index) {
+        uint64_t oldHead = list.load(std::memory_order_acquire);
+        while (indexOf(oldHead) != NIL) {
+            uint32_t next = nodeAt(indexOf(oldHead))->next.load(std::memory_order_relaxed);
+            uint64_t newHead = pack(next, tagOf(oldHead) + 1);
+            if (list.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+                index = indexOf(oldHead);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Push an already linked chain first..last onto a Treiber list
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    void pushChain(std::atomic<uint64_t>& list, uint32_t first, uint32_t last) {
+        Node* lastNode = nodeAt(last);
+        uint64_t oldHead = list.load(std::memory_order_relaxed);
+        do {
+            lastNode->next.store(indexOf(oldHead), std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(oldHead, pack(first, tagOf(oldHead) + 1),
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+
+    /**
+     * Get a node from the free list, or carve a fresh one from the pool
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1) amortized
+     */
+    uint32_t allocateNode(const T& element) {
+        uint32_t index;
+        if (!tryPopIndex(freeHead, index)) {
+            index = nextFreshIndex.fetch_add(1, std::memory_order_relaxed);
+            ensureChunk(index);
+        }
+        nodeAt(index)->data = element;
+        return index;
+    }
+
+    void releaseNode(uint32_t index) {
+        pushChain(freeHead, index, index);
+    }
+
+    /**
+     * Offer a pushed node to a waiting pop; returns true if a pop took it
+     * Time Complexity: O(ELIMINATION_SPINS)
+     * Space Complexity: O(1)
+     */
+    bool tryEliminatePush(uint32_t index) {
+        std::atomic<uint64_t>& slot = elimination[randomSlot()];
+        uint64_t offer = pack(index, eliminationTag.fetch_add(1, std::memory_order_relaxed));
+        uint64_t expected = EMPTY_SLOT;
+        if (!slot.compare_exchange_strong(expected, offer, std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+            return false;
+        }
+        for (int spin = 0; spin < ELIMINATION_SPINS; spin++) {
+            if (slot.load(std::memory_order_acquire) != offer) {
+                return true;
+            }
+        }
+        // Nobody came: withdraw the offer unless a pop grabbed it just now
+        expected = offer;
+        return !slot.compare_exchange_strong(expected, EMPTY_SLOT, std::memory_order_acq_rel,
+                                             std::memory_order_acquire);
+    }
+
+    /**
+     * Take a node offered by a concurrent push, if any
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool tryEliminatePop(uint32_t& index) {
+        std::atomic<uint64_t>& slot = elimination[randomSlot()];
+        uint64_t offer = slot.load(std::memory_order_acquire);
+        if (offer == EMPTY_SLOT) {
+            return false;
+        }
+        if (slot.compare_exchange_strong(offer, EMPTY_SLOT, std::memory_order_acq_rel,
+                                         std::memory_order_relaxed)) {
+            index = indexOf(offer);
+            return true;
+        }
+        return false;
+    }
+
+    static int randomSlot() {
+        thread_local std::minstd_rand generator(
+            static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+        return static_cast<int>(generator() % ELIMINATION_SLOTS);
+    }
+
+    /**
+     * Publish an owned node on the stack, falling back to elimination on contention
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    void pushNode(uint32_t index) {
+        Node* node = nodeAt(index);
+        uint64_t oldHead = head.load(std::memory_order_relaxed);
+        while (true) {
+            node->next.store(indexOf(oldHead), std::memory_order_relaxed);
+            if (head.compare_exchange_weak(oldHead, pack(index, tagOf(oldHead) + 1),
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+                return;
+            }
+            if (tryEliminatePush(index)) {
+                return;
+            }
+            oldHead = head.load(std::memory_order_relaxed);
+        }
+    }
+
+public:
+    /**
+     * Constructor - Initialize empty stack
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    LockFreeStack() : head(pack(NIL, 0)), freeHead(pack(NIL, 0)), count(0),
+                      nextFreshIndex(0), eliminationTag(0) {
+        for (int i = 0; i < MAX_CHUNKS; i++) {
+            chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+        for (int i = 0; i < ELIMINATION_SLOTS; i++) {
+            elimination[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+        }
+    }
+
+    // Shared between threads by reference; copying would break the protocol
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    /**
+     * Destructor - release every pool chunk at once
+     * Time Complexity: O(number of chunks)
+     * Space Complexity: O(1)
+     */
+    ~LockFreeStack() {
+        for (int i = 0; i < MAX_CHUNKS; i++) {
+            delete[] chunks[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Push element onto stack
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1) amortized
+     */
+    void push(const T& element) {
+        pushNode(allocateNode(element));
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Push a range of elements with a single CAS on the head
+     * Elements end up in the same order as consecutive push calls would leave them
+     * Time Complexity: O(k) to link the chain, one CAS to publish it
+     * Space Complexity: O(1) amortized per element
+     */
+    template<typename InputIt>
+    void pushBatch(InputIt first, InputIt last) {
+        if (first == last) {
+            return;
+        }
+
+        // The first element becomes the bottom of the chain
+        uint32_t bottom = allocateNode(*first);
+        uint32_t top = bottom;
+        int added = 1;
+        for (++first; first != last; ++first) {
+            uint32_t index = allocateNode(*first);
+            nodeAt(index)->next.store(top, std::memory_order_relaxed);
+            top = index;
+            added++;
+        }
+
+        pushChain(head, top, bottom);
+        count.fetch_add(added, std::memory_order_relaxed);
+    }
+
+    /**
+     * Try to pop the top element without throwing
+     * Returns false if the stack is empty
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    bool tryPop(T& result) {
+        uint32_t index;
+        while (true) {
+            uint64_t oldHead = head.load(std::memory_order_acquire);
+            if (indexOf(oldHead) == NIL) {
+                return false;
+            }
+            uint32_t next = nodeAt(indexOf(oldHead))->next.load(std::memory_order_relaxed);
+            if (head.compare_exchange_weak(oldHead, pack(next, tagOf(oldHead) + 1),
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+                index = indexOf(oldHead);
+                break;
+            }
+            if (tryEliminatePop(index)) {
+                break;
+            }
+        }
+
+        result = nodeAt(index)->data;
+        releaseNode(index);
+        count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Pop element from stack
+     * Time Complexity: O(1) expected, lock-free
+     * Space Complexity: O(1)
+     */
+    T pop() {
+        T result;
+        if (!tryPop(result)) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return result;
+    }
+
+    /**
+     * Peek at top element without removing
+     * Quiescent only: call it when no other thread is pushing or popping.
+     * The top node is not owned by the caller, so a concurrent pop could
+     * recycle it and overwrite its data mid-copy; use tryPop to take the
+     * top element safely under concurrency.
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T peek() const {
+        uint64_t top = head.load(std::memory_order_acquire);
+        if (indexOf(top) == NIL) {
+            throw std::underflow_error("Stack is empty");
+        }
+        return nodeAt(indexOf(top))->data;
+    }
+
+    /**
+     * Check if stack is empty (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return indexOf(head.load(std::memory_order_acquire)) == NIL;
+    }
+
+    /**
+     * Get number of elements in stack (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        int current = count.load(std::memory_order_relaxed);
+        return current > 0 ? current : 0;
+    }
+};
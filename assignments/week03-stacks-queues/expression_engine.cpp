@@ -0,0 +1,498 @@
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Compiled Expression Engine
+ * infixToPostfix/evaluatePostfix re-parse characters on every evaluation and
+ * only understand single-digit operands. ExpressionProgram parses an infix
+ * formula once (shunting-yard) into a flat RPN bytecode with multi-digit
+ * literals and named variables, then evaluates it any number of times on a
+ * fixed-size operand stack without allocating.
+ *
+ * Supported syntax: integer literals, identifiers, + - * / % ^, unary minus
+ * and parentheses. ^ binds tighter than unary minus and is right associative,
+ * so -2^2 = -4 and 2^3^2 = 512. Arithmetic is on long long and checked:
+ * a result that does not fit (including LLONG_MIN / -1) throws
+ * std::overflow_error instead of wrapping or trapping.
+ */
+
+class ExpressionProgram {
+public:
+    static const int MAX_STACK_DEPTH = 64;
+    static const int BATCH_BLOCK = 64;
+
+private:
+    enum OpCode : unsigned char {
+        PUSH_CONST,
+        PUSH_VAR,
+        ADD,
+        SUB,
+        MUL,
+        DIV,
+        MOD,
+        POW,
+        NEG
+    };
+
+    struct Instruction {
+        OpCode op;
+        long long operand;  // literal value or variable slot
+    };
+
+    std::vector<Instruction> code;
+    std::vector<std::string> variableNames;
+    int maxDepth;
+
+    // Operator-stack entries used while compiling
+    enum PendingOp : char {
+        PENDING_PAREN = '(',
+        PENDING_NEG = '~'
+    };
+
+    static int precedence(char op) {
+        switch (op) {
+            case '+':
+            case '-':
+                return 1;
+            case '*':
+            case '/':
+            case '%':
+                return 2;
+            case PENDING_NEG:
+                return 3;
+            case '^':
+                return 4;
+            default:
+                return 0;
+        }
+    }
+
+    static bool isRightAssociative(char op) {
+        return op == '^' || op == PENDING_NEG;
+    }
+
+    static OpCode opcodeFor(char op) {
+        switch (op) {
+            case '+': return ADD;
+            case '-': return SUB;
+            case '*': return MUL;
+            case '/': return DIV;
+            case '%': return MOD;
+            case '^': return POW;
+            default: return NEG;
+        }
+    }
+
+    /**
+     * Append an instruction and track the operand stack depth it needs
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1) amortized
+     */
+    void emit(OpCode op, long long operand, int& depth) {
+        if (op == PUSH_CONST || op == PUSH_VAR) {
+            depth++;
+        } else if (op == NEG) {
+            if (depth < 1) {
+                throw std::invalid_argument("Invalid expression: missing operand");
+            }
+        } else {
+            if (depth < 2) {
+                throw std::invalid_argument("Invalid expression: missing operand");
+            }
+            depth--;
+        }
+
+        if (depth > MAX_STACK_DEPTH) {
+            throw std::invalid_argument("Expression too deeply nested");
+        }
+        maxDepth = std::max(maxDepth, depth);
+        code.push_back({op, operand});
+    }
+
+    int variableSlot(const std::string& name) const {
+        for (size_t i = 0; i < variableNames.size(); i++) {
+            if (variableNames[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        throw std::invalid_argument("Unknown variable: " + name);
+    }
+
+    /**
+     * Integer power by repeated squaring
+     * Time Complexity: O(log exponent)
+     * Space Complexity: O(1)
+     */
+    static long long power(long long base, long long exponent) {
+        if (exponent < 0) {
+            throw std::invalid_argument("Negative exponent");
+        }
+        long long result = 1;
+        while (exponent > 0) {
+            if ((exponent & 1) && __builtin_mul_overflow(result, base, &result)) {
+                throw std::overflow_error("Integer overflow");
+            }
+            exponent >>= 1;
+            if (exponent > 0 && __builtin_mul_overflow(base, base, &base)) {
+                throw std::overflow_error("Integer overflow");
+            }
+        }
+        return result;
+    }
+
+    static long long negate(long long a) {
+        long long result;
+        if (__builtin_sub_overflow(0LL, a, &result)) {
+            throw std::overflow_error("Integer overflow");
+        }
+        return result;
+    }
+
+    /**
+     * Apply a binary operator, with the same error reporting as evaluatePostfix
+     * Results that do not fit in a long long throw std::overflow_error.
+     * Time Complexity: O(1), O(log b) for ^
+     * Space Complexity: O(1)
+     */
+    static long long apply(OpCode op, long long a, long long b) {
+        long long result = 0;
+        bool overflow = false;
+        switch (op) {
+            case ADD:
+                overflow = __builtin_add_overflow(a, b, &result);
+                break;
+            case SUB:
+                overflow = __builtin_sub_overflow(a, b, &result);
+                break;
+            case MUL:
+                overflow = __builtin_mul_overflow(a, b, &result);
+                break;
+            case DIV:
+                if (b == 0) {
+                    throw std::runtime_error("Division by zero");
+                }
+                // LLONG_MIN / -1 traps on x86
+                overflow = b == -1 && a == std::numeric_limits<long long>::min();
+                result = overflow ? 0 : a / b;
+                break;
+            case MOD:
+                if (b == 0) {
+                    throw std::runtime_error("Modulo by zero");
+                }
+                result = b == -1 ? 0 : a % b;
+                break;
+            default:
+                return power(a, b);
+        }
+        if (overflow) {
+            throw std::overflow_error("Integer overflow");
+        }
+        return result;
+    }
+
+    ExpressionProgram() : maxDepth(0) {}
+
+public:
+    /**
+     * Compile an infix expression; variables are bound by position at evaluation
+     * Time Complexity: O(n + v * k) for n characters, v variables, k identifiers
+     * Space Complexity: O(n)
+     */
+    static ExpressionProgram compile(const std::string& infix,
+                                     const std::vector<std::string>& variables = {}) {
+        ExpressionProgram program;
+        program.variableNames = variables;
+
+        std::vector<char> operators;
+        int depth = 0;
+        bool expectOperand = true;
+
+        auto popOperator = [&]() {
+            program.emit(opcodeFor(operators.back()), 0, depth);
+            operators.pop_back();
+        };
+
+        size_t i = 0;
+        while (i < infix.length()) {
+            char ch = infix[i];
+
+            if (std::isspace(static_cast<unsigned char>(ch))) {
+                i++;
+            } else if (std::isdigit(static_cast<unsigned char>(ch))) {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Invalid expression: missing operator");
+                }
+                long long value = 0;
+                while (i < infix.length() && std::isdigit(static_cast<unsigned char>(infix[i]))) {
+                    if (__builtin_mul_overflow(value, 10LL, &value) ||
+                        __builtin_add_overflow(value, static_cast<long long>(infix[i] - '0'), &value)) {
+                        throw std::overflow_error("Integer literal out of range");
+                    }
+                    i++;
+                }
+                program.emit(PUSH_CONST, value, depth);
+                expectOperand = false;
+            } else if (std::isalpha(static_cast<unsigned char>(ch)) || ch == '_') {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Invalid expression: missing operator");
+                }
+                size_t start = i;
+                while (i < infix.length() &&
+                       (std::isalnum(static_cast<unsigned char>(infix[i])) || infix[i] == '_')) {
+                    i++;
+                }
+                program.emit(PUSH_VAR, program.variableSlot(infix.substr(start, i - start)), depth);
+                expectOperand = false;
+            } else if (ch == '(') {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Invalid expression: missing operator");
+                }
+                operators.push_back(PENDING_PAREN);
+                i++;
+            } else if (ch == ')') {
+                while (!operators.empty() && operators.back() != PENDING_PAREN) {
+                    popOperator();
+                }
+                if (operators.empty()) {
+                    throw std::invalid_argument("Mismatched parentheses");
+                }
+                operators.pop_back();
+                expectOperand = false;
+                i++;
+            } else if (ch == '+' || ch == '-' || ch == '*' || ch == '/' || ch == '%' || ch == '^') {
+                char op = ch;
+                if (expectOperand) {
+                    if (ch == '-') {
+                        op = PENDING_NEG;
+                    } else if (ch == '+') {
+                        i++;  // unary plus is a no-op
+                        continue;
+                    } else {
+                        throw std::invalid_argument("Invalid expression: missing operand");
+                    }
+                }
+
+                // Prefix operators have nothing to their left to reduce
+                if (op != PENDING_NEG) {
+                    while (!operators.empty() && operators.back() != PENDING_PAREN &&
+                           (precedence(operators.back()) > precedence(op) ||
+                            (precedence(operators.back()) == precedence(op) &&
+                             !isRightAssociative(op)))) {
+                        popOperator();
+                    }
+                }
+                operators.push_back(op);
+                expectOperand = true;
+                i++;
+            } else {
+                throw std::invalid_argument(std::string("Invalid character in expression: ") + ch);
+            }
+        }
+
+        while (!operators.empty()) {
+            if (operators.back() == PENDING_PAREN) {
+                throw std::invalid_argument("Mismatched parentheses");
+            }
+            popOperator();
+        }
+
+        if (depth != 1) {
+            throw std::invalid_argument("Invalid expression");
+        }
+        return program;
+    }
+
+    /**
+     * Evaluate with bindings[i] as the value of variables[i]
+     * Time Complexity: O(program length)
+     * Space Complexity: O(1) - fixed operand stack, no allocation
+     */
+    long long evaluate(const long long* bindings) const {
+        long long stack[MAX_STACK_DEPTH];
+        int top = -1;
+
+        for (const Instruction& instruction : code) {
+            switch (instruction.op) {
+                case PUSH_CONST:
+                    stack[++top] = instruction.operand;
+                    break;
+                case PUSH_VAR:
+                    stack[++top] = bindings[instruction.operand];
+                    break;
+                case NEG:
+                    stack[top] = negate(stack[top]);
+                    break;
+                default:
+                    stack[top - 1] = apply(instruction.op, stack[top - 1], stack[top]);
+                    top--;
+                    break;
+            }
+        }
+        return stack[0];
+    }
+
+    /**
+     * Evaluate with a vector of bindings
+     * Time Complexity: O(program length)
+     * Space Complexity: O(1)
+     */
+    long long evaluate(const std::vector<long long>& bindings = {}) const {
+        if (bindings.size() < variableNames.size()) {
+            throw std::invalid_argument("Missing variable bindings");
+        }
+        return evaluate(bindings.data());
+    }
+
+    /**
+     * Evaluate the program over count rows of column-major bindings:
+     * columns[v][row] is the value of variable v in that row.
+     * Instructions are dispatched once per block of BATCH_BLOCK rows instead
+     * of once per row, and every inner loop is a simple vectorizable sweep.
+     * Time Complexity: O(program length * count)
+     * Space Complexity: O(1) extra beyond results
+     */
+    void evaluateBatch(const std::vector<const long long*>& columns, size_t count,
+                       long long* results) const {
+        if (columns.size() < variableNames.size()) {
+            throw std::invalid_argument("Missing variable bindings");
+        }
+
+        long long stack[MAX_STACK_DEPTH][BATCH_BLOCK];
+
+        for (size_t base = 0; base < count; base += BATCH_BLOCK) {
+            int rows = static_cast<int>(std::min<size_t>(BATCH_BLOCK, count - base));
+            int top = -1;
+            bool overflow = false;  // checked once per block to keep the sweeps branch-free
+
+            for (const Instruction& instruction : code) {
+                switch (instruction.op) {
+                    case PUSH_CONST:
+                        top++;
+                        for (int r = 0; r < rows; r++) {
+                            stack[top][r] = instruction.operand;
+                        }
+                        break;
+                    case PUSH_VAR: {
+                        top++;
+                        const long long* column = columns[instruction.operand] + base;
+                        for (int r = 0; r < rows; r++) {
+                            stack[top][r] = column[r];
+                        }
+                        break;
+                    }
+                    case NEG:
+                        for (int r = 0; r < rows; r++) {
+                            overflow |= __builtin_sub_overflow(0LL, stack[top][r], &stack[top][r]);
+                        }
+                        break;
+                    case ADD:
+                        for (int r = 0; r < rows; r++) {
+                            overflow |= __builtin_add_overflow(stack[top - 1][r], stack[top][r],
+                                                               &stack[top - 1][r]);
+                        }
+                        top--;
+                        break;
+                    case SUB:
+                        for (int r = 0; r < rows; r++) {
+                            overflow |= __builtin_sub_overflow(stack[top - 1][r], stack[top][r],
+                                                               &stack[top - 1][r]);
+                        }
+                        top--;
+                        break;
+                    case MUL:
+                        for (int r = 0; r < rows; r++) {
+                            overflow |= __builtin_mul_overflow(stack[top - 1][r], stack[top][r],
+                                                               &stack[top - 1][r]);
+                        }
+                        top--;
+                        break;
+                    default:
+                        for (int r = 0; r < rows; r++) {
+                            stack[top - 1][r] = apply(instruction.op, stack[top - 1][r],
+                                                      stack[top][r]);
+                        }
+                        top--;
+                        break;
+                }
+            }
+
+            if (overflow) {
+                throw std::overflow_error("Integer overflow");
+            }
+            for (int r = 0; r < rows; r++) {
+                results[base + r] = stack[0][r];
+            }
+        }
+    }
+
+    /**
+     * Batch evaluation returning a vector of results
+     * A program without variables yields a single result
+     * Time Complexity: O(program length * count)
+     * Space Complexity: O(count)
+     */
+    std::vector<long long> evaluateBatch(const std::vector<std::vector<long long>>& columns) const {
+        if (columns.size() < variableNames.size()) {
+            throw std::invalid_argument("Missing variable bindings");
+        }
+
+        size_t count = columns.empty() ? 1 : columns[0].size();
+        std::vector<const long long*> pointers;
+        for (const std::vector<long long>& column : columns) {
+            if (column.size() != count) {
+                throw std::invalid_argument("Binding columns must have equal length");
+            }
+            pointers.push_back(column.data());
+        }
+
+        std::vector<long long> results(count);
+        evaluateBatch(pointers, count, results.data());
+        return results;
+    }
+
+    /**
+     * Get number of bytecode instructions
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int length() const {
+        return static_cast<int>(code.size());
+    }
+
+    /**
+     * Get operand stack depth the program needs
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int stackDepth() const {
+        return maxDepth;
+    }
+
+    /**
+     * Render the bytecode as a postfix string (for debugging)
+     * Time Complexity: O(program length)
+     * Space Complexity: O(program length)
+     */
+    std::string toPostfix() const {
+        static const char symbols[] = {' ', ' ', '+', '-', '*', '/', '%', '^', '~'};
+        std::string result;
+        for (const Instruction& instruction : code) {
+            if (!result.empty()) {
+                result += ' ';
+            }
+            if (instruction.op == PUSH_CONST) {
+                result += std::to_string(instruction.operand);
+            } else if (instruction.op == PUSH_VAR) {
+                result += variableNames[instruction.operand];
+            } else {
+                result += symbols[instruction.op];
+            }
+        }
+        return result;
+    }
+};
@@ -0,0 +1,783 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <queue>
+#include <stack>
+#include <thread>
+#include "stack.cpp"
+#include "queue.cpp"
+#include "applications.cpp"
+#include "concurrent_queue.cpp"
+#include "expression_engine.cpp"
+#include "bracket_checker.cpp"
+#include "sliding_window.cpp"
+#include "binary_labels.cpp"
+#include "frontier_bfs.cpp"
+#include "monotonic_stack.cpp"
+#include "segmented_queue.cpp"
+
+/**
+ * Queue<T> guarded by a single mutex - baseline for the concurrent benchmarks
+ */
+template<typename T>
+class LockedQueue {
+private:
+    Queue<T> queue;
+    mutable std::mutex mutex;
+    int capacity;
+
+public:
+    LockedQueue(int maxSize) : capacity(maxSize) {}
+
+    bool tryEnqueue(const T& element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.size() >= capacity) {
+            return false;
+        }
+        queue.enqueue(element);
+        return true;
+    }
+
+    bool tryDequeue(T& result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isEmpty()) {
+            return false;
+        }
+        result = queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * Original two-queue stack (O(n) push) - baseline for the adapter benchmark
+ */
+class LegacyStackUsingQueues {
+private:
+    std::queue<int> q1, q2;
+
+public:
+    void push(int x) {
+        q2.push(x);
+        while (!q1.empty()) {
+            q2.push(q1.front());
+            q1.pop();
+        }
+        std::swap(q1, q2);
+    }
+
+    int pop() {
+        int top = q1.front();
+        q1.pop();
+        return top;
+    }
+
+    bool empty() {
+        return q1.empty();
+    }
+};
+
+/**
+ * Original two-std::stack queue - baseline for the adapter benchmark
+ */
+class LegacyQueueUsingStacks {
+private:
+    std::stack<int> stack1, stack2;
+
+public:
+    void enqueue(int x) {
+        stack1.push(x);
+    }
+
+    int dequeue() {
+        if (stack2.empty()) {
+            while (!stack1.empty()) {
+                stack2.push(stack1.top());
+                stack1.pop();
+            }
+        }
+        int front = stack2.top();
+        stack2.pop();
+        return front;
+    }
+
+    bool empty() {
+        return stack1.empty() && stack2.empty();
+    }
+};
+
+/**
+ * Drive an adapter with a given push percentage and return elapsed microseconds
+ * pushPercent = -1 runs a burst: all pushes first, then all pops.
+ */
+template<typename Push, typename Pop, typename Empty>
+long long runAdapterMix(int operations, int pushPercent, Push push, Pop pop, Empty empty, long long& checksum) {
+    unsigned int state = 12345;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (pushPercent < 0) {
+        for (int i = 0; i < operations / 2; i++) {
+            push(i);
+        }
+        while (!empty()) {
+            checksum += pop();
+        }
+    } else {
+        for (int i = 0; i < operations; i++) {
+            state = state * 1103515245u + 12345u;
+            if (static_cast<int>((state >> 16) % 100) < pushPercent || empty()) {
+                push(i);
+            } else {
+                checksum += pop();
+            }
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+/**
+ * Run producers/consumers against a queue and return elapsed microseconds
+ * Half of the threads produce and half consume (at least one of each)
+ */
+template<typename QueueType>
+long long runContention(QueueType& queue, int numThreads, int totalItems) {
+    int producers = std::max(1, numThreads / 2);
+    int consumers = std::max(1, numThreads - producers);
+    int itemsPerProducer = totalItems / producers;
+    int itemsPerConsumer = itemsPerProducer * producers / consumers;
+    int leftover = itemsPerProducer * producers - itemsPerConsumer * consumers;
+
+    std::vector<std::thread> threads;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, itemsPerProducer]() {
+            for (int i = 0; i < itemsPerProducer; i++) {
+                while (!queue.tryEnqueue(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int c = 0; c < consumers; c++) {
+        int count = itemsPerConsumer + (c == 0 ? leftover : 0);
+        threads.emplace_back([&queue, count]() {
+            int value;
+            for (int i = 0; i < count; i++) {
+                while (!queue.tryDequeue(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+void benchmarkQueueContention() {
+    const int TOTAL_ITEMS = 200000;
+    const int QUEUE_CAPACITY = 1024;
+
+    std::cout << "Transferring " << TOTAL_ITEMS << " items (hardware threads: "
+              << std::thread::hardware_concurrency() << ")" << std::endl;
+    std::cout << "Threads\tMutex Queue (us)\tMPMCQueue (us)" << std::endl;
+
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        LockedQueue<int> locked(QUEUE_CAPACITY);
+        MPMCQueue<int> lockFree(QUEUE_CAPACITY);
+
+        long long lockedTime = runContention(locked, threads, TOTAL_ITEMS);
+        long long lockFreeTime = runContention(lockFree, threads, TOTAL_ITEMS);
+
+        std::cout << threads << "\t" << lockedTime << "\t\t\t" << lockFreeTime << std::endl;
+    }
+}
+
+/**
+ * Dijkstra-like monotone workload: every pop schedules two later keys
+ * Returns elapsed microseconds; checksum keeps the work observable
+ */
+template<typename PopKey, typename Push>
+long long runMonotoneWorkload(int operations, PopKey popKey, Push push, unsigned long long& checksum) {
+    unsigned int seed = 12345;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    push(0u);
+    for (int i = 0; i < operations; i++) {
+        unsigned int current = popKey();
+        checksum += current;
+        for (int j = 0; j < 2; j++) {
+            seed = seed * 1103515245u + 12345u;
+            push(current + (seed >> 16) % 1000);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+void benchmarkMonotonePriorityQueues() {
+    const int OPERATIONS = 1000000;
+    unsigned long long binarySum = 0;
+    unsigned long long fourArySum = 0;
+    unsigned long long radixSum = 0;
+    unsigned long long bucketSum = 0;
+
+    PriorityQueue<unsigned int, 2, std::greater<unsigned int>> binaryHeap;
+    long long binaryTime = runMonotoneWorkload(
+        OPERATIONS, [&]() { return binaryHeap.dequeue(); },
+        [&](unsigned int key) { binaryHeap.enqueue(key); }, binarySum);
+
+    PriorityQueue<unsigned int, 4, std::greater<unsigned int>> fourAryHeap;
+    long long fourAryTime = runMonotoneWorkload(
+        OPERATIONS, [&]() { return fourAryHeap.dequeue(); },
+        [&](unsigned int key) { fourAryHeap.enqueue(key); }, fourArySum);
+
+    RadixHeap<unsigned int> radixHeap;
+    unsigned int maxKey = 0;
+    long long radixTime = runMonotoneWorkload(
+        OPERATIONS, [&]() { return radixHeap.dequeue(); },
+        [&](unsigned int key) {
+            radixHeap.enqueue(key);
+            maxKey = std::max(maxKey, key);
+        },
+        radixSum);
+
+    // The bucket queue is bounded by absolute priority: size it from the run above
+    BucketQueue<unsigned int> bucketQueue(maxKey);
+    long long bucketTime = runMonotoneWorkload(
+        OPERATIONS, [&]() { return bucketQueue.dequeue(); },
+        [&](unsigned int key) { bucketQueue.enqueue(key, key); }, bucketSum);
+
+    std::cout << OPERATIONS << " pops, 2 monotone pushes per pop:" << std::endl;
+    std::cout << "Binary heap:  " << binaryTime << " microseconds" << std::endl;
+    std::cout << "4-ary heap:   " << fourAryTime << " microseconds" << std::endl;
+    std::cout << "Radix heap:   " << radixTime << " microseconds" << std::endl;
+    std::cout << "Bucket queue: " << bucketTime << " microseconds" << std::endl;
+    std::cout << "Checksums agree: " << std::boolalpha
+              << (binarySum == fourArySum && fourArySum == radixSum && radixSum == bucketSum)
+              << std::endl;
+}
+
+void benchmarkExpressionEngine() {
+    const int ROWS = 200000;
+    std::vector<long long> xs(ROWS);
+    std::vector<long long> ys(ROWS);
+    std::vector<std::string> rowExpressions(ROWS);
+    for (int i = 0; i < ROWS; i++) {
+        xs[i] = i % 10;
+        ys[i] = (i / 10) % 9 + 1;
+        // Single-digit operands so the legacy evaluator can parse the same rows
+        rowExpressions[i] = "(" + std::to_string(xs[i]) + "+" + std::to_string(ys[i]) + ")*" +
+                            std::to_string(xs[i]) + "-" + std::to_string(ys[i]) + "^2";
+    }
+
+    long long legacySum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ROWS; i++) {
+        legacySum += evaluatePostfix(infixToPostfix(rowExpressions[i]));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long legacyTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    ExpressionProgram program = ExpressionProgram::compile("(x + y) * x - y ^ 2", {"x", "y"});
+
+    long long compiledSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ROWS; i++) {
+        long long row[2] = {xs[i], ys[i]};
+        compiledSum += program.evaluate(row);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long compiledTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long batchSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<long long> results = program.evaluateBatch({xs, ys});
+    for (long long value : results) {
+        batchSum += value;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long batchTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << ROWS << " evaluations of (x + y) * x - y ^ 2:" << std::endl;
+    std::cout << "Parse + evaluate per row: " << legacyTime << " microseconds" << std::endl;
+    std::cout << "Compiled, per row:        " << compiledTime << " microseconds" << std::endl;
+    std::cout << "Compiled, batched:        " << batchTime << " microseconds" << std::endl;
+    std::cout << "Checksums agree: " << std::boolalpha
+              << (legacySum == compiledSum && compiledSum == batchSum) << std::endl;
+}
+
+void benchmarkBracketChecker() {
+    // JSON-like payload of roughly 8 MB
+    std::string payload = "[";
+    for (int i = 0; payload.size() < (8u << 20); i++) {
+        payload += "{\"id\": " + std::to_string(i) + ", \"tags\": [\"a\", \"b\"], \"f\": (x)},";
+    }
+    payload += "]";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    long long stackResult = findUnbalancedPosition(payload);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long stackTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    long long chunkedResult = findUnbalancedPositionParallel(payload, 1);
+    end = std::chrono::high_resolution_clock::now();
+    long long chunkedTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    long long parallelResult = findUnbalancedPositionParallel(payload);
+    end = std::chrono::high_resolution_clock::now();
+    long long parallelTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << payload.size() << " byte payload:" << std::endl;
+    std::cout << "Stack<char> scan:         " << stackTime << " microseconds" << std::endl;
+    std::cout << "Chunked, single thread:   " << chunkedTime << " microseconds" << std::endl;
+    std::cout << "Chunked, parallel:        " << parallelTime << " microseconds" << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (stackResult == chunkedResult && chunkedResult == parallelResult) << std::endl;
+}
+
+void benchmarkSlidingWindow() {
+    const int N = 2000000;
+    const int K = 1000;
+    std::vector<int> stream(N);
+    for (int i = 0; i < N; i++) {
+        stream[i] = static_cast<int>((i * 2654435761u) % 100000);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<int> dequeResult = slidingWindowMaximum(stream, K);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long dequeTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<int> windowResult = slidingWindowAggregate<MaxAgg<int>>(stream, K);
+    end = std::chrono::high_resolution_clock::now();
+    long long windowTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // Vector-at-a-time ingestion: one query per batch of 4096
+    std::vector<long long> wideStream(stream.begin(), stream.end());
+    SlidingWindow<SumAgg<long long>> sumWindow(K);
+    long long batchChecksum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < N; i += 4096) {
+        sumWindow.pushMany(wideStream.data() + i, std::min(4096, N - i));
+        batchChecksum += sumWindow.query();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long batchTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << N << " values, window " << K << ":" << std::endl;
+    std::cout << "slidingWindowMaximum (deque):  " << dequeTime << " microseconds" << std::endl;
+    std::cout << "SlidingWindow<MaxAgg>:         " << windowTime << " microseconds" << std::endl;
+    std::cout << "SlidingWindow<SumAgg> batched: " << batchTime << " microseconds (checksum "
+              << batchChecksum << ")" << std::endl;
+    std::cout << "Results agree: " << std::boolalpha << (dequeResult == windowResult) << std::endl;
+}
+
+void benchmarkAdapters() {
+    // The legacy stack pushes in O(n), so keep the stack runs small
+    const int STACK_OPERATIONS = 20000;
+    const int QUEUE_OPERATIONS = 2000000;
+    const int mixes[] = {75, 50, -1};
+    const char* mixNames[] = {"75% push", "50% push", "burst   "};
+
+    for (int m = 0; m < 3; m++) {
+        long long legacySum = 0;
+        long long adapterSum = 0;
+
+        LegacyStackUsingQueues legacyStack;
+        long long legacyStackTime = runAdapterMix(
+            STACK_OPERATIONS, mixes[m], [&](int x) { legacyStack.push(x); },
+            [&]() { return legacyStack.pop(); }, [&]() { return legacyStack.empty(); }, legacySum);
+
+        StackUsingQueues<int> stack;
+        long long stackTime = runAdapterMix(
+            STACK_OPERATIONS, mixes[m], [&](int x) { stack.push(x); },
+            [&]() { return stack.pop(); }, [&]() { return stack.empty(); }, adapterSum);
+
+        LegacyQueueUsingStacks legacyQueue;
+        long long legacyQueueTime = runAdapterMix(
+            QUEUE_OPERATIONS, mixes[m], [&](int x) { legacyQueue.enqueue(x); },
+            [&]() { return legacyQueue.dequeue(); }, [&]() { return legacyQueue.empty(); }, legacySum);
+
+        QueueUsingStacks<int> queue;
+        long long queueTime = runAdapterMix(
+            QUEUE_OPERATIONS, mixes[m], [&](int x) { queue.enqueue(x); },
+            [&]() { return queue.dequeue(); }, [&]() { return queue.empty(); }, adapterSum);
+
+        std::cout << mixNames[m] << "  stack (" << STACK_OPERATIONS << " ops): legacy "
+                  << legacyStackTime << " us, adapter " << stackTime << " us" << std::endl;
+        std::cout << "          queue (" << QUEUE_OPERATIONS << " ops): legacy "
+                  << legacyQueueTime << " us, adapter " << queueTime << " us, checksums agree: "
+                  << std::boolalpha << (legacySum == adapterSum) << std::endl;
+    }
+}
+
+void benchmarkJosephus() {
+    const int SIMULATION_N = 100000;
+    const long long LARGE_N = 20000000;
+    const int ORDER_N = 2000000;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int simulated = josephusSimulation(SIMULATION_N, 3);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long simulationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    long long closedForm = josephusSurvivor(SIMULATION_N, 3);
+    end = std::chrono::high_resolution_clock::now();
+    long long closedFormTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "n = " << SIMULATION_N << ", k = 3: queue simulation " << simulationTime
+              << " us, josephusSurvivor " << closedFormTime << " us, agree: " << std::boolalpha
+              << (simulated == closedForm) << std::endl;
+
+    for (long long k : {3LL, 1000LL, 10000000LL}) {
+        start = std::chrono::high_resolution_clock::now();
+        long long linear = josephusLinear(LARGE_N, k);
+        end = std::chrono::high_resolution_clock::now();
+        long long linearTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        long long logarithmic = josephusLogarithmic(LARGE_N, k);
+        end = std::chrono::high_resolution_clock::now();
+        long long logTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        std::cout << "n = " << LARGE_N << ", k = " << k << ": O(n) " << linearTime << " us, O(k log n) "
+                  << logTime << " us, agree: " << (linear == logarithmic) << std::endl;
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<int> order = josephusEliminationOrder(ORDER_N, 7);
+    end = std::chrono::high_resolution_clock::now();
+    long long orderTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "Elimination order, n = " << ORDER_N << ", k = 7: " << orderTime
+              << " us, last matches survivor: " << (order.back() == josephusSurvivor(ORDER_N, 7)) << std::endl;
+}
+
+void benchmarkBinaryLabels() {
+    const int N = 2000000;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::string> strings = generateBinaryNumbers(N);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long queueTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    PackedBinaryNumbers packed(N);
+    end = std::chrono::high_resolution_clock::now();
+    long long packedTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    PackedBinaryNumbers parallel(N, 0);
+    end = std::chrono::high_resolution_clock::now();
+    long long parallelTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    bool agree = true;
+    for (int i = 0; i < N; i += 9973) {
+        agree = agree && packed[i] == strings[i] && parallel[i] == strings[i];
+    }
+
+    std::cout << N << " binary labels (" << packed.bytes() << " packed bytes):" << std::endl;
+    std::cout << "generateBinaryNumbers:        " << queueTime << " microseconds" << std::endl;
+    std::cout << "PackedBinaryNumbers:          " << packedTime << " microseconds" << std::endl;
+    std::cout << "PackedBinaryNumbers parallel: " << parallelTime << " microseconds" << std::endl;
+    std::cout << "Samples agree: " << std::boolalpha << agree << std::endl;
+}
+
+void benchmarkFrontierBFS() {
+    const int N = 500000;
+    const int EDGES = N * 8;
+    std::vector<std::vector<int>> adjacency(N);
+    unsigned int state = 2024;
+    for (int i = 0; i < EDGES; i++) {
+        state = state * 1103515245u + 12345u;
+        int u = static_cast<int>((state >> 8) % N);
+        state = state * 1103515245u + 12345u;
+        int v = static_cast<int>((state >> 8) % N);
+        adjacency[u].push_back(v);
+        adjacency[v].push_back(u);
+    }
+    CSRGraph graph = CSRGraph::fromAdjacencyList(adjacency);
+
+    // Same traversal as levelOrderTraversal, minus the printing
+    auto start = std::chrono::high_resolution_clock::now();
+    Queue<int> queue;
+    std::vector<bool> visited(N, false);
+    int reached = 0;
+    queue.enqueue(0);
+    visited[0] = true;
+    while (!queue.isEmpty()) {
+        int vertex = queue.dequeue();
+        reached++;
+        for (int neighbor : adjacency[vertex]) {
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                queue.enqueue(neighbor);
+            }
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long queueTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long times[2];
+    size_t levelCounts[2];
+    int frontierTotals[2];
+    BFSDirection directions[] = {BFSDirection::TOP_DOWN, BFSDirection::AUTO};
+    for (int d = 0; d < 2; d++) {
+        start = std::chrono::high_resolution_clock::now();
+        std::vector<std::vector<int>> levels = levelOrderFrontiers(graph, 0, &graph, directions[d]);
+        end = std::chrono::high_resolution_clock::now();
+        times[d] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        levelCounts[d] = levels.size();
+        frontierTotals[d] = 0;
+        for (const std::vector<int>& level : levels) {
+            frontierTotals[d] += static_cast<int>(level.size());
+        }
+    }
+
+    std::cout << N << " vertices, " << 2 * EDGES << " directed edges:" << std::endl;
+    std::cout << "Queue BFS (adjacency list):     " << queueTime << " microseconds" << std::endl;
+    std::cout << "CSR frontiers, top-down only:   " << times[0] << " microseconds" << std::endl;
+    std::cout << "CSR frontiers, direction-opt.:  " << times[1] << " microseconds ("
+              << levelCounts[1] << " levels)" << std::endl;
+    std::cout << "Reached counts agree: " << std::boolalpha
+              << (reached == frontierTotals[0] && frontierTotals[0] == frontierTotals[1]
+                  && levelCounts[0] == levelCounts[1]) << std::endl;
+}
+
+void benchmarkMonotonicStack() {
+    const int HISTOGRAMS = 20000;
+    const int BARS = 256;
+    std::vector<std::vector<int>> histograms(HISTOGRAMS, std::vector<int>(BARS));
+    unsigned int state = 99;
+    for (std::vector<int>& histogram : histograms) {
+        for (int& height : histogram) {
+            state = state * 1103515245u + 12345u;
+            height = static_cast<int>((state >> 8) % 10000);
+        }
+    }
+
+    long long originalSum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const std::vector<int>& histogram : histograms) {
+        originalSum += largestRectangleArea(histogram);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long originalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long engineSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    MonotonicStackEngine engine;
+    for (const std::vector<int>& histogram : histograms) {
+        engineSum += engine.largestRectangle(histogram.data(), BARS);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long engineTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long batchSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (long long area : largestRectangleBatch(histograms)) {
+        batchSum += area;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long batchTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << HISTOGRAMS << " histograms of " << BARS << " bars:" << std::endl;
+    std::cout << "largestRectangleArea (std::stack): " << originalTime << " microseconds" << std::endl;
+    std::cout << "MonotonicStackEngine, reused:      " << engineTime << " microseconds" << std::endl;
+    std::cout << "largestRectangleBatch (threads):   " << batchTime << " microseconds" << std::endl;
+    std::cout << "Sums agree: " << std::boolalpha
+              << (originalSum == engineSum && engineSum == batchSum) << std::endl;
+}
+
+void benchmarkSegmentedQueue() {
+    const int OPERATIONS = 4000000;
+
+    // Worst single enqueue shows the resize copy; total shows throughput
+    auto run = [&](auto& queue, auto enqueue, auto dequeue) {
+        long long worst = 0;
+        long long checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < OPERATIONS; i++) {
+            auto before = std::chrono::high_resolution_clock::now();
+            enqueue(queue, i);
+            auto after = std::chrono::high_resolution_clock::now();
+            worst = std::max(worst, static_cast<long long>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()));
+            if (i % 4 == 3) {
+                checksum += dequeue(queue);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        long long total = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        return std::vector<long long>{total, worst, checksum};
+    };
+
+    Queue<int> arrayQueue;
+    std::vector<long long> arrayResult = run(arrayQueue,
+        [](Queue<int>& q, int v) { q.enqueue(v); },
+        [](Queue<int>& q) { return q.dequeue(); });
+
+    SegmentedQueue<int> segmentedQueue;
+    std::vector<long long> segmentedResult = run(segmentedQueue,
+        [](SegmentedQueue<int>& q, int v) { q.enqueue(v); },
+        [](SegmentedQueue<int>& q) { return q.dequeue(); });
+
+    std::deque<int> standardDeque;
+    std::vector<long long> dequeResult = run(standardDeque,
+        [](std::deque<int>& q, int v) { q.push_back(v); },
+        [](std::deque<int>& q) { int v = q.front(); q.pop_front(); return v; });
+
+    std::cout << OPERATIONS << " enqueues, one dequeue per four:" << std::endl;
+    std::cout << "Queue<T> (doubling copy): " << arrayResult[0] << " microseconds, worst enqueue "
+              << arrayResult[1] << " ns" << std::endl;
+    std::cout << "SegmentedQueue:           " << segmentedResult[0] << " microseconds, worst enqueue "
+              << segmentedResult[1] << " ns" << std::endl;
+    std::cout << "std::deque:               " << dequeResult[0] << " microseconds, worst enqueue "
+              << dequeResult[1] << " ns" << std::endl;
+    std::cout << "Checksums agree: " << std::boolalpha
+              << (arrayResult[2] == segmentedResult[2] && segmentedResult[2] == dequeResult[2]) << std::endl;
+
+    const int K = 1000000;
+    Queue<int> reverseArray;
+    SegmentedQueue<int> reverseSegmented;
+    for (int i = 0; i < 2 * K; i++) {
+        reverseArray.enqueue(i);
+        reverseSegmented.enqueue(i);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    reverseFirstKElements(reverseArray, K);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long arrayReverse = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    start = std::chrono::high_resolution_clock::now();
+    reverseFirstKElements(reverseSegmented, K);
+    end = std::chrono::high_resolution_clock::now();
+    long long segmentedReverse = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "reverseFirstKElements, k = " << K << " of " << 2 * K << ":" << std::endl;
+    std::cout << "Queue<T> (temporary stack + rotation): " << arrayReverse << " microseconds" << std::endl;
+    std::cout << "SegmentedQueue (in-place swaps):       " << segmentedReverse << " microseconds" << std::endl;
+    std::cout << "Fronts agree: " << std::boolalpha << (reverseArray.front() == reverseSegmented.front()) << std::endl;
+}
+
+int main() {
+    std::cout << "======================================" << std::endl;
+    std::cout << " DSA Week 3: Stacks and Queues Demonstration" << std::endl;
+    std::cout << "======================================" << std::endl;
+
+    // Demonstrate Stack
+    std::cout << "\n1. Stack Implementation:" << std::endl;
+    std::cout << "------------------------" << std::endl;
+    demonstrateStack();
+
+    std::cout << "\n\n";
+
+    // Demonstrate Queue
+    std::cout << "2. Queue Implementation:" << std::endl;
+    std::cout << "------------------------" << std::endl;
+    demonstrateQueue();
+
+    std::cout << "\n\n";
+
+    // Demonstrate Advanced Applications
+    std::cout << "3. Advanced Applications:" << std::endl;
+    std::cout << "-------------------------" << std::endl;
+    demonstrateAdvancedApplications();
+
+    std::cout << "\n\n";
+
+    // Concurrent queue contention
+    std::cout << "4. MPMC Queue Contention Benchmark:" << std::endl;
+    std::cout << "-----------------------------------" << std::endl;
+    benchmarkQueueContention();
+
+    std::cout << "\n\n";
+
+    // Monotone priority queues
+    std::cout << "5. Monotone Priority Queue Throughput:" << std::endl;
+    std::cout << "--------------------------------------" << std::endl;
+    benchmarkMonotonePriorityQueues();
+
+    std::cout << "\n\n";
+
+    // Compiled expressions
+    std::cout << "6. Expression Engine Throughput:" << std::endl;
+    std::cout << "--------------------------------" << std::endl;
+    benchmarkExpressionEngine();
+
+    std::cout << "\n\n";
+
+    // Bracket balance on large payloads
+    std::cout << "7. Bracket Checker Throughput:" << std::endl;
+    std::cout << "------------------------------" << std::endl;
+    benchmarkBracketChecker();
+
+    std::cout << "\n\n";
+
+    // Streaming window aggregates
+    std::cout << "8. Sliding Window Aggregates:" << std::endl;
+    std::cout << "-----------------------------" << std::endl;
+    benchmarkSlidingWindow();
+
+    std::cout << "\n\n";
+
+    // Stack/queue adapters
+    std::cout << "9. Adapter Operation Mixes:" << std::endl;
+    std::cout << "---------------------------" << std::endl;
+    benchmarkAdapters();
+
+    std::cout << "\n\n";
+
+    // Josephus solvers
+    std::cout << "10. Josephus Solvers:" << std::endl;
+    std::cout << "---------------------" << std::endl;
+    benchmarkJosephus();
+
+    std::cout << "\n\n";
+
+    // Packed binary labels
+    std::cout << "11. Binary Label Generation:" << std::endl;
+    std::cout << "----------------------------" << std::endl;
+    benchmarkBinaryLabels();
+
+    std::cout << "\n\n";
+
+    // Level-order traversal over CSR
+    std::cout << "12. Frontier BFS:" << std::endl;
+    std::cout << "-----------------" << std::endl;
+    benchmarkFrontierBFS();
+
+    std::cout << "\n\n";
+
+    // Monotonic stack engine
+    std::cout << "13. Monotonic Stack Engine:" << std::endl;
+    std::cout << "---------------------------" << std::endl;
+    benchmarkMonotonicStack();
+
+    std::cout << "\n\n";
+
+    // Segmented block-list queue
+    std::cout << "14. Segmented Queue:" << std::endl;
+    std::cout << "--------------------" << std::endl;
+    benchmarkSegmentedQueue();
+
+    std::cout << "\n======================================" << std::endl;
+    std::cout << " Week 3 Demonstration Complete!" << std::endl;
+    std::cout << "======================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#ifndef MONOIDS_H
+#define MONOIDS_H
+
+#include <limits>
+#include <numeric>
+
+/**
+ * Monoid policies shared by the aggregating containers
+ * (SlidingWindow, AggregatingStack). Each provides value_type, identity()
+ * and an associative combine(older, newer).
+ */
+
+template<typename T>
+struct MaxAgg {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T combine(const T& a, const T& b) { return a < b ? b : a; }
+};
+
+template<typename T>
+struct MinAgg {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T combine(const T& a, const T& b) { return b < a ? b : a; }
+};
+
+template<typename T>
+struct SumAgg {
+    using value_type = T;
+    static T identity() { return T(); }
+    static T combine(const T& a, const T& b) { return a + b; }
+};
+
+template<typename T>
+struct GcdAgg {
+    using value_type = T;
+    static T identity() { return T(); }
+    static T combine(const T& a, const T& b) { return std::gcd(a, b); }
+};
+
+#endif
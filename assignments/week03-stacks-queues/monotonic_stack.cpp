@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * Monotonic-Stack Engine
+ * nextGreaterElement and largestRectangleArea each build a std::stack<int>
+ * per call. MonotonicStackEngine runs the same monotonic-stack passes over
+ * raw arrays using a scratch buffer that is either supplied by the caller
+ * (the engine then never allocates) or owned and reused across calls.
+ *
+ * One pass yields both directions: when index i pops j, i is j's next
+ * strictly greater (smaller) element; whatever is left on top when i is
+ * pushed is i's previous greater-or-equal (smaller-or-equal) element.
+ * Indices are reported, -1 meaning "none".
+ */
+
+class MonotonicStackEngine {
+private:
+    std::vector<int> ownedScratch;
+    int* scratch;
+    int capacity;
+    bool owning;
+
+    int* reserve(int needed) {
+        if (needed > capacity) {
+            if (!owning) {
+                throw std::invalid_argument("Scratch buffer too small");
+            }
+            ownedScratch.resize(std::max(needed, 2 * capacity));
+            scratch = ownedScratch.data();
+            capacity = static_cast<int>(ownedScratch.size());
+        }
+        return scratch;
+    }
+
+    /**
+     * Shared pass: pops while compare(values[top], values[i])
+     * Time Complexity: O(n)
+     * Space Complexity: O(1) beyond scratch
+     */
+    template<typename Compare>
+    void nearest(const int* values, int n, int* next, int* previous, Compare compare) {
+        int* stack = reserve(n);
+        int top = 0;
+
+        for (int i = 0; i < n; i++) {
+            while (top > 0 && compare(values[stack[top - 1]], values[i])) {
+                top--;
+                if (next != nullptr) {
+                    next[stack[top]] = i;
+                }
+            }
+            if (previous != nullptr) {
+                previous[i] = top > 0 ? stack[top - 1] : -1;
+            }
+            stack[top++] = i;
+        }
+        if (next != nullptr) {
+            while (top > 0) {
+                next[stack[--top]] = -1;
+            }
+        }
+    }
+
+public:
+    /**
+     * Constructor - Engine that owns and reuses its scratch buffer
+     * Time Complexity: O(1)
+     * Space Complexity: O(1) until first use
+     */
+    MonotonicStackEngine() : scratch(nullptr), capacity(0), owning(true) {}
+
+    /**
+     * Constructor - Engine over a caller-provided scratch buffer
+     * Inputs longer than the buffer throw std::invalid_argument.
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    MonotonicStackEngine(int* buffer, int bufferSize) : scratch(buffer), capacity(bufferSize), owning(false) {
+        if (buffer == nullptr || bufferSize < 0) {
+            throw std::invalid_argument("Invalid scratch buffer");
+        }
+    }
+
+    // Copies would alias a caller-provided buffer or a stale pointer
+    MonotonicStackEngine(const MonotonicStackEngine&) = delete;
+    MonotonicStackEngine& operator=(const MonotonicStackEngine&) = delete;
+
+    /**
+     * Next strictly greater and previous greater-or-equal element indices
+     * Either output may be nullptr.
+     * Time Complexity: O(n)
+     * Space Complexity: O(n) scratch
+     */
+    void nearestGreater(const int* values, int n, int* next, int* previous) {
+        nearest(values, n, next, previous, std::less<int>());
+    }
+
+    /**
+     * Next strictly smaller and previous smaller-or-equal element indices
+     * Time Complexity: O(n)
+     * Space Complexity: O(n) scratch
+     */
+    void nearestSmaller(const int* values, int n, int* next, int* previous) {
+        nearest(values, n, next, previous, std::greater<int>());
+    }
+
+    /**
+     * Largest rectangle in a histogram
+     * Scratch needs n + 1 entries (the final zero-height bar is pushed too).
+     * Time Complexity: O(n)
+     * Space Complexity: O(n) scratch
+     */
+    long long largestRectangle(const int* heights, int n) {
+        int* stack = reserve(n + 1);
+        int top = 0;
+        long long best = 0;
+
+        for (int i = 0; i <= n; i++) {
+            int height = i < n ? heights[i] : 0;
+            while (top > 0 && heights[stack[top - 1]] >= height) {
+                long long barHeight = heights[stack[--top]];
+                int left = top > 0 ? stack[top - 1] : -1;
+                best = std::max(best, barHeight * (i - left - 1));
+            }
+            stack[top++] = i;
+        }
+        return best;
+    }
+
+    /**
+     * Largest all-ones rectangle in a row-major binary matrix
+     * Each row turns into a histogram of consecutive ones above it.
+     * Scratch needs 2 * cols + 1 entries (heights plus stack).
+     * Time Complexity: O(rows * cols)
+     * Space Complexity: O(cols) scratch
+     */
+    long long maximalRectangle(const unsigned char* cells, int rows, int cols) {
+        if (rows <= 0 || cols <= 0) {
+            return 0;
+        }
+        int* heights = reserve(2 * cols + 1);
+        std::fill(heights, heights + cols, 0);
+        int* stack = heights + cols;
+        long long best = 0;
+
+        for (int r = 0; r < rows; r++) {
+            const unsigned char* row = cells + static_cast<long long>(r) * cols;
+            for (int c = 0; c < cols; c++) {
+                heights[c] = row[c] ? heights[c] + 1 : 0;
+            }
+
+            int top = 0;
+            for (int c = 0; c <= cols; c++) {
+                int height = c < cols ? heights[c] : 0;
+                while (top > 0 && heights[stack[top - 1]] >= height) {
+                    long long barHeight = heights[stack[--top]];
+                    int left = top > 0 ? stack[top - 1] : -1;
+                    best = std::max(best, barHeight * (c - left - 1));
+                }
+                stack[top++] = c;
+            }
+        }
+        return best;
+    }
+
+    long long maximalRectangle(const std::vector<std::vector<int>>& matrix) {
+        if (matrix.empty() || matrix[0].empty()) {
+            return 0;
+        }
+        int rows = static_cast<int>(matrix.size());
+        int cols = static_cast<int>(matrix[0].size());
+        std::vector<unsigned char> cells(static_cast<size_t>(rows) * cols);
+        for (int r = 0; r < rows; r++) {
+            if (static_cast<int>(matrix[r].size()) != cols) {
+                throw std::invalid_argument("Matrix rows must have equal length");
+            }
+            for (int c = 0; c < cols; c++) {
+                cells[static_cast<size_t>(r) * cols + c] = matrix[r][c] != 0;
+            }
+        }
+        return maximalRectangle(cells.data(), rows, cols);
+    }
+};
+
+/**
+ * Run work(engine, index) for every index in [0, count) across threads
+ * Each worker owns one engine, so scratch is allocated once per thread;
+ * indices are handed out in small blocks to balance uneven inputs.
+ * Time Complexity: O(total work / threads)
+ * Space Complexity: O(threads * largest input) scratch
+ */
+template<typename Work>
+void monotonicBatch(int count, int threads, Work work) {
+    if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    threads = std::max(1, std::min(threads, count));
+    const int BLOCK = 16;
+    std::atomic<int> nextIndex(0);
+
+    auto worker = [&]() {
+        MonotonicStackEngine engine;
+        for (;;) {
+            int begin = nextIndex.fetch_add(BLOCK);
+            if (begin >= count) {
+                return;
+            }
+            int end = std::min(count, begin + BLOCK);
+            for (int i = begin; i < end; i++) {
+                work(engine, i);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+}
+
+/**
+ * Largest rectangle of many independent histograms
+ * Time Complexity: O(total bars / threads)
+ * Space Complexity: O(histograms.size()) results
+ */
+std::vector<long long> largestRectangleBatch(const std::vector<std::vector<int>>& histograms, int threads = 0) {
+    std::vector<long long> results(histograms.size());
+    monotonicBatch(static_cast<int>(histograms.size()), threads, [&](MonotonicStackEngine& engine, int i) {
+        results[i] = engine.largestRectangle(histograms[i].data(), static_cast<int>(histograms[i].size()));
+    });
+    return results;
+}
+
+/**
+ * Next greater element values (-1 if none) of many independent inputs,
+ * same convention as nextGreaterElement
+ * Time Complexity: O(total elements / threads)
+ * Space Complexity: O(total elements) results
+ */
+std::vector<std::vector<int>> nextGreaterBatch(const std::vector<std::vector<int>>& inputs, int threads = 0) {
+    std::vector<std::vector<int>> results(inputs.size());
+    monotonicBatch(static_cast<int>(inputs.size()), threads, [&](MonotonicStackEngine& engine, int i) {
+        const std::vector<int>& values = inputs[i];
+        std::vector<int>& result = results[i];
+        result.resize(values.size());
+        engine.nearestGreater(values.data(), static_cast<int>(values.size()), result.data(), nullptr);
+        for (int& index : result) {
+            index = index == -1 ? -1 : values[index];
+        }
+    });
+    return results;
+}
@@ -1,5 +1,11 @@
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /**
@@ -217,47 +223,104 @@ public:
 };
 
 /**
- * Priority Queue implementation using max heap
+ * Priority Queue implementation using a d-ary max heap
+ * Arity children per node (default 4): a shallower tree than a binary heap,
+ * and all children of a node sit next to each other in the same cache line.
+ * Compare follows std::priority_queue: with std::less the largest element is
+ * on top, with std::greater the smallest.
  */
-template<typename T>
+template<typename T, int Arity = 4, typename Compare = std::less<T>>
 class PriorityQueue {
 private:
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
     std::vector<T> heap;
+    Compare compare;
     
-    int parent(int i) { return (i - 1) / 2; }
-    int leftChild(int i) { return 2 * i + 1; }
-    int rightChild(int i) { return 2 * i + 2; }
+    int parent(int i) const { return (i - 1) / Arity; }
+    int firstChild(int i) const { return Arity * i + 1; }
     
+    /**
+     * Move element at index up until its parent has higher priority
+     * Time Complexity: O(log_d n)
+     * Space Complexity: O(1)
+     */
     void heapifyUp(int index) {
-        while (index > 0 && heap[parent(index)] < heap[index]) {
-            std::swap(heap[parent(index)], heap[index]);
+        T element = std::move(heap[index]);
+        while (index > 0 && compare(heap[parent(index)], element)) {
+            heap[index] = std::move(heap[parent(index)]);
             index = parent(index);
         }
+        heap[index] = std::move(element);
     }
     
+    /**
+     * Move element at index down below its highest-priority child (iterative)
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
     void heapifyDown(int index) {
-        int maxIndex = index;
-        int left = leftChild(index);
-        int right = rightChild(index);
-        
-        if (left < heap.size() && heap[left] > heap[maxIndex]) {
-            maxIndex = left;
-        }
+        int n = static_cast<int>(heap.size());
+        T element = std::move(heap[index]);
         
-        if (right < heap.size() && heap[right] > heap[maxIndex]) {
-            maxIndex = right;
-        }
-        
-        if (index != maxIndex) {
-            std::swap(heap[index], heap[maxIndex]);
-            heapifyDown(maxIndex);
+        while (true) {
+            int first = firstChild(index);
+            if (first >= n) {
+                break;
+            }
+            
+            int last = std::min(first + Arity, n);
+            int best = first;
+            for (int child = first + 1; child < last; child++) {
+                if (compare(heap[best], heap[child])) {
+                    best = child;
+                }
+            }
+            
+            if (!compare(element, heap[best])) {
+                break;
+            }
+            heap[index] = std::move(heap[best]);
+            index = best;
         }
+        heap[index] = std::move(element);
     }
 
 public:
+    /**
+     * Constructor with optional comparator
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    PriorityQueue(const Compare& comp = Compare()) : compare(comp) {}
+    
+    /**
+     * Construct from a range in linear time
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    template<typename InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare& comp = Compare())
+        : compare(comp) {
+        buildHeap(first, last);
+    }
+    
+    /**
+     * Replace contents with a range using bottom-up (Floyd) heap construction
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    template<typename InputIt>
+    void buildHeap(InputIt first, InputIt last) {
+        heap.assign(first, last);
+        for (int i = parent(static_cast<int>(heap.size()) - 1); i >= 0; i--) {
+            heapifyDown(i);
+        }
+    }
+    
     /**
      * Insert element with priority
-     * Time Complexity: O(log n)
+     * Time Complexity: O(log_d n)
      * Space Complexity: O(1)
      */
     void enqueue(const T& element) {
@@ -267,7 +330,7 @@ public:
 
     /**
      * Remove and return highest priority element
-     * Time Complexity: O(log n)
+     * Time Complexity: O(d log_d n)
      * Space Complexity: O(1)
      */
     T dequeue() {
@@ -275,8 +338,8 @@ public:
             throw std::underflow_error("Priority queue is empty");
         }
         
-        T maxElement = heap[0];
-        heap[0] = heap.back();
+        T maxElement = std::move(heap[0]);
+        heap[0] = std::move(heap.back());
         heap.pop_back();
         
         if (!isEmpty()) {
@@ -317,14 +380,595 @@ public:
     }
 };
 
+/**
+ * Indexed Priority Queue (d-ary heap with handles)
+ * enqueue returns a stable handle that can later be used to change the
+ * element's key or remove it, as needed by Dijkstra/Prim and schedulers.
+ * The heap stores handles; a position table maps each handle back to its
+ * slot so lookups by handle are O(1). Released handles are reused.
+ */
+template<typename T, int Arity = 4, typename Compare = std::less<T>>
+class IndexedPriorityQueue {
+public:
+    using Handle = int;
+
+private:
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+    std::vector<Handle> heap;       // heap of handles
+    std::vector<T> keys;            // keys[handle]
+    std::vector<int> position;      // position[handle] = index in heap, -1 if free
+    std::vector<Handle> freeHandles;
+    Compare compare;
+    
+    int parent(int i) const { return (i - 1) / Arity; }
+    int firstChild(int i) const { return Arity * i + 1; }
+    
+    // True if handle a has lower priority than handle b
+    bool lower(Handle a, Handle b) const {
+        return compare(keys[a], keys[b]);
+    }
+    
+    void place(int index, Handle handle) {
+        heap[index] = handle;
+        position[handle] = index;
+    }
+    
+    /**
+     * Time Complexity: O(log_d n)
+     * Space Complexity: O(1)
+     */
+    void heapifyUp(int index) {
+        Handle handle = heap[index];
+        while (index > 0 && lower(heap[parent(index)], handle)) {
+            place(index, heap[parent(index)]);
+            index = parent(index);
+        }
+        place(index, handle);
+    }
+    
+    /**
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void heapifyDown(int index) {
+        int n = static_cast<int>(heap.size());
+        Handle handle = heap[index];
+        
+        while (true) {
+            int first = firstChild(index);
+            if (first >= n) {
+                break;
+            }
+            
+            int last = std::min(first + Arity, n);
+            int best = first;
+            for (int child = first + 1; child < last; child++) {
+                if (lower(heap[best], heap[child])) {
+                    best = child;
+                }
+            }
+            
+            if (!lower(handle, heap[best])) {
+                break;
+            }
+            place(index, heap[best]);
+            index = best;
+        }
+        place(index, handle);
+    }
+    
+    /**
+     * Store a new key for a handle and sift it the one way its priority
+     * moved: down if it dropped, up otherwise
+     * Time Complexity: O(d log_d n) down, O(log_d n) up
+     * Space Complexity: O(1)
+     */
+    void changeKey(Handle handle, const T& element) {
+        bool dropped = compare(element, keys[handle]);
+        keys[handle] = element;
+        if (dropped) {
+            heapifyDown(position[handle]);
+        } else {
+            heapifyUp(position[handle]);
+        }
+    }
+    
+    void checkHandle(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::invalid_argument("Invalid priority queue handle");
+        }
+    }
+    
+    /**
+     * Remove the element stored at heap index and release its handle
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void removeAt(int index) {
+        Handle removed = heap[index];
+        Handle moved = heap.back();
+        heap.pop_back();
+        position[removed] = -1;
+        freeHandles.push_back(removed);
+        
+        if (index < static_cast<int>(heap.size())) {
+            place(index, moved);
+            heapifyUp(index);
+            heapifyDown(position[moved]);
+        }
+    }
+
+public:
+    /**
+     * Constructor with optional comparator
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    IndexedPriorityQueue(const Compare& comp = Compare()) : compare(comp) {}
+    
+    /**
+     * Insert element and return its handle
+     * Time Complexity: O(log_d n)
+     * Space Complexity: O(1) amortized
+     */
+    Handle enqueue(const T& element) {
+        Handle handle;
+        if (!freeHandles.empty()) {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+            keys[handle] = element;
+        } else {
+            handle = static_cast<Handle>(keys.size());
+            keys.push_back(element);
+            position.push_back(-1);
+        }
+        
+        heap.push_back(handle);
+        position[handle] = static_cast<int>(heap.size()) - 1;
+        heapifyUp(position[handle]);
+        return handle;
+    }
+    
+    /**
+     * Remove and return highest priority element
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    T dequeue() {
+        if (isEmpty()) {
+            throw std::underflow_error("Priority queue is empty");
+        }
+        T element = keys[heap[0]];
+        removeAt(0);
+        return element;
+    }
+    
+    /**
+     * Get highest priority element without removing
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T top() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Priority queue is empty");
+        }
+        return keys[heap[0]];
+    }
+    
+    /**
+     * Get handle of highest priority element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    Handle topHandle() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Priority queue is empty");
+        }
+        return heap[0];
+    }
+    
+    /**
+     * Get current key of a handle
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T key(Handle handle) const {
+        checkHandle(handle);
+        return keys[handle];
+    }
+    
+    /**
+     * Check if handle refers to an element still in the queue
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool contains(Handle handle) const {
+        return handle >= 0 && handle < static_cast<Handle>(position.size()) &&
+               position[handle] != -1;
+    }
+    
+    /**
+     * Change the key of a handle, moving it up or down as needed
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void update(Handle handle, const T& element) {
+        checkHandle(handle);
+        changeKey(handle, element);
+    }
+    
+    /**
+     * Lower the key of a handle (element must not be above the old key by
+     * T's operator<). The element sinks in a max heap and rises in a min
+     * heap (std::greater), so Dijkstra-style relaxations work either way;
+     * Compare decides which single direction to sift
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void decreaseKey(Handle handle, const T& element) {
+        checkHandle(handle);
+        if (keys[handle] < element) {
+            throw std::invalid_argument("decreaseKey with a larger key");
+        }
+        changeKey(handle, element);
+    }
+    
+    /**
+     * Raise the key of a handle (element must not be below the old key)
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void increaseKey(Handle handle, const T& element) {
+        checkHandle(handle);
+        if (element < keys[handle]) {
+            throw std::invalid_argument("increaseKey with a smaller key");
+        }
+        changeKey(handle, element);
+    }
+    
+    /**
+     * Remove an arbitrary element by handle
+     * Time Complexity: O(d log_d n)
+     * Space Complexity: O(1)
+     */
+    void erase(Handle handle) {
+        checkHandle(handle);
+        removeAt(position[handle]);
+    }
+    
+    /**
+     * Check if priority queue is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return heap.empty();
+    }
+    
+    /**
+     * Get number of elements
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        return heap.size();
+    }
+};
+
+/**
+ * Radix Heap - monotone min priority queue for unsigned integer keys
+ * Keys popped never decrease (timer wheels, Dijkstra with integer weights),
+ * so every element only moves towards bucket 0 and is touched O(log C)
+ * times over its lifetime, where C is the largest key distance.
+ * Bucket i > 0 holds keys whose highest bit differing from the last popped
+ * key is bit i-1; bucket 0 holds keys equal to the last popped key.
+ * dequeue/top return the value (by default the key itself). Peeking does
+ * not move the last popped key, so after top() keys between it and the
+ * peeked minimum can still be enqueued.
+ */
+template<typename Key = unsigned int, typename Value = Key>
+class RadixHeap {
+private:
+    static_assert(std::is_unsigned<Key>::value, "RadixHeap keys must be unsigned integers");
+    static const int NUM_BUCKETS = std::numeric_limits<Key>::digits + 1;
+
+    std::vector<std::pair<Key, Value>> buckets[NUM_BUCKETS];
+    Key lastKey;
+    int currentSize;
+    // Minimum found by a peek while bucket 0 was empty: the entry pull()
+    // would move to buckets[0].back(); cachedBucket == 0 means none
+    int cachedBucket;
+    size_t cachedIndex;
+
+    int bucketIndex(Key key) const {
+        if (key == lastKey) {
+            return 0;
+        }
+        unsigned long long diff = static_cast<unsigned long long>(key ^ lastKey);
+        return 64 - __builtin_clzll(diff);
+    }
+
+    /**
+     * Locate the smallest entry without redistributing: the last entry of
+     * bucket 0 or else the last smallest entry of the first non-empty
+     * bucket, which is the one dequeue returns after pull()
+     * Time Complexity: O(bucket size), once per pull
+     * Space Complexity: O(1)
+     */
+    const std::pair<Key, Value>& findMin() {
+        if (!buckets[0].empty()) {
+            return buckets[0].back();
+        }
+        if (cachedBucket == 0) {
+            int i = 1;
+            while (buckets[i].empty()) {
+                i++;
+            }
+            size_t best = 0;
+            for (size_t j = 1; j < buckets[i].size(); j++) {
+                if (!(buckets[i][best].first < buckets[i][j].first)) {
+                    best = j;
+                }
+            }
+            cachedBucket = i;
+            cachedIndex = best;
+        }
+        return buckets[cachedBucket][cachedIndex];
+    }
+
+    /**
+     * Refill bucket 0 from the first non-empty bucket
+     * Time Complexity: O(bucket size) amortized over the elements moved
+     * Space Complexity: O(1)
+     */
+    void pull() {
+        if (!buckets[0].empty()) {
+            return;
+        }
+
+        lastKey = findMin().first;
+        int i = cachedBucket;
+        cachedBucket = 0;
+
+        // Every element lands in a strictly smaller bucket
+        for (auto& entry : buckets[i]) {
+            buckets[bucketIndex(entry.first)].push_back(std::move(entry));
+        }
+        buckets[i].clear();
+    }
+
+public:
+    /**
+     * Constructor - Initialize empty heap
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    RadixHeap() : lastKey(0), currentSize(0), cachedBucket(0), cachedIndex(0) {}
+
+    /**
+     * Insert key with an associated value
+     * Key must not be smaller than the last key removed (peeking with
+     * top/topKey does not count)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1) amortized
+     */
+    void enqueue(const Key& key, const Value& value) {
+        if (key < lastKey) {
+            throw std::invalid_argument("RadixHeap keys must be monotone");
+        }
+        int bucket = bucketIndex(key);
+        buckets[bucket].emplace_back(key, value);
+        currentSize++;
+        // A key at or below a peeked minimum becomes the new minimum
+        if (cachedBucket != 0 && bucket != 0 && !(buckets[cachedBucket][cachedIndex].first < key)) {
+            cachedBucket = bucket;
+            cachedIndex = buckets[bucket].size() - 1;
+        }
+    }
+
+    /**
+     * Insert key that is also its own value
+     * Time Complexity: O(1)
+     * Space Complexity: O(1) amortized
+     */
+    void enqueue(const Key& key) {
+        enqueue(key, key);
+    }
+
+    /**
+     * Remove and return value with the smallest key
+     * Time Complexity: O(log C) amortized
+     * Space Complexity: O(1)
+     */
+    Value dequeue() {
+        if (isEmpty()) {
+            throw std::underflow_error("Radix heap is empty");
+        }
+        pull();
+        Value value = std::move(buckets[0].back().second);
+        buckets[0].pop_back();
+        currentSize--;
+        return value;
+    }
+
+    /**
+     * Get value with the smallest key without removing; the last popped
+     * key, and so the lowest key enqueue accepts, stays the same
+     * Time Complexity: O(log C) amortized
+     * Space Complexity: O(1)
+     */
+    Value top() {
+        if (isEmpty()) {
+            throw std::underflow_error("Radix heap is empty");
+        }
+        return findMin().second;
+    }
+
+    /**
+     * Get smallest key without removing (does not move the last popped key)
+     * Time Complexity: O(log C) amortized
+     * Space Complexity: O(1)
+     */
+    Key topKey() {
+        if (isEmpty()) {
+            throw std::underflow_error("Radix heap is empty");
+        }
+        return findMin().first;
+    }
+
+    /**
+     * Check if queue is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    /**
+     * Get number of elements
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        return currentSize;
+    }
+};
+
+/**
+ * Bucket Queue (Dial's algorithm) - min priority queue for small integer keys
+ * One bucket per priority in [0, maxPriority]; a cursor remembers the lowest
+ * possibly non-empty bucket. Enqueue is O(1) and dequeue is O(1) amortized
+ * when keys are monotone, since the cursor only sweeps the range once.
+ * Smaller keys than the cursor are still accepted (the cursor moves back).
+ */
+template<typename Value = int>
+class BucketQueue {
+private:
+    std::vector<std::vector<Value>> buckets;
+    int cursor;
+    int currentSize;
+
+    /**
+     * Advance cursor to the first non-empty bucket
+     * Time Complexity: O(distance moved)
+     * Space Complexity: O(1)
+     */
+    void advance() {
+        while (buckets[cursor].empty()) {
+            cursor++;
+        }
+    }
+
+public:
+    /**
+     * Constructor - keys must lie in [0, maxPriority]
+     * Time Complexity: O(maxPriority)
+     * Space Complexity: O(maxPriority)
+     */
+    BucketQueue(int maxPriority) : cursor(0), currentSize(0) {
+        if (maxPriority < 0) {
+            throw std::invalid_argument("Maximum priority must be non-negative");
+        }
+        buckets.resize(maxPriority + 1);
+    }
+
+    /**
+     * Insert value with priority
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1) amortized
+     */
+    void enqueue(int priority, const Value& value) {
+        if (priority < 0 || priority >= static_cast<int>(buckets.size())) {
+            throw std::out_of_range("Priority outside bucket range");
+        }
+        buckets[priority].push_back(value);
+        if (currentSize == 0 || priority < cursor) {
+            cursor = priority;
+        }
+        currentSize++;
+    }
+
+    /**
+     * Insert priority that is also its own value
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1) amortized
+     */
+    void enqueue(int priority) {
+        enqueue(priority, priority);
+    }
+
+    /**
+     * Remove and return value with the smallest priority
+     * Time Complexity: O(1) amortized for monotone workloads
+     * Space Complexity: O(1)
+     */
+    Value dequeue() {
+        if (isEmpty()) {
+            throw std::underflow_error("Bucket queue is empty");
+        }
+        advance();
+        Value value = std::move(buckets[cursor].back());
+        buckets[cursor].pop_back();
+        currentSize--;
+        return value;
+    }
+
+    /**
+     * Get value with the smallest priority without removing
+     * Time Complexity: O(1) amortized for monotone workloads
+     * Space Complexity: O(1)
+     */
+    Value top() {
+        if (isEmpty()) {
+            throw std::underflow_error("Bucket queue is empty");
+        }
+        advance();
+        return buckets[cursor].back();
+    }
+
+    /**
+     * Get smallest priority without removing
+     * Time Complexity: O(1) amortized for monotone workloads
+     * Space Complexity: O(1)
+     */
+    int topPriority() {
+        if (isEmpty()) {
+            throw std::underflow_error("Bucket queue is empty");
+        }
+        advance();
+        return cursor;
+    }
+
+    /**
+     * Check if queue is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    /**
+     * Get number of elements
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        return currentSize;
+    }
+};
+
 // Queue Applications
 
 /**
- * Solve Josephus Problem using circular queue
+ * Solve Josephus Problem by simulating the circle with a queue
+ * Kept as the reference implementation for the closed-form solvers below.
  * Time Complexity: O(n * k)
  * Space Complexity: O(n)
  */
-int josephusProblem(int n, int k) {
+int josephusSimulation(int n, int k) {
     if (n <= 0 || k <= 0) {
         throw std::invalid_argument("n and k must be positive");
     }
@@ -350,6 +994,149 @@ int josephusProblem(int n, int k) {
     return queue.front();
 }
 
+/**
+ * Josephus survivor via the recurrence J(1) = 0, J(i) = (J(i-1) + k) mod i
+ * Time Complexity: O(n)
+ * Space Complexity: O(1)
+ */
+long long josephusLinear(long long n, long long k) {
+    if (n <= 0 || k <= 0) {
+        throw std::invalid_argument("n and k must be positive");
+    }
+    
+    long long survivor = 0;
+    for (long long i = 2; i <= n; i++) {
+        survivor = (survivor + k) % i;
+    }
+    return survivor + 1;
+}
+
+/**
+ * Josephus survivor for small k
+ * One pass around a circle of n people removes floor(n / k) of them, so
+ * the problem shrinks to n - n/k people; the survivor's index in the
+ * smaller circle maps back to the larger one with a little arithmetic.
+ * The chain of circle sizes is stored explicitly instead of recursing.
+ * Time Complexity: O(k log n)
+ * Space Complexity: O(k log n)
+ */
+long long josephusLogarithmic(long long n, long long k) {
+    if (n <= 0 || k <= 0) {
+        throw std::invalid_argument("n and k must be positive");
+    }
+    if (k == 1) {
+        return n;
+    }
+    
+    // Circle sizes visited on the way down
+    std::vector<long long> sizes;
+    for (long long m = n; m > 1; ) {
+        sizes.push_back(m);
+        m = (k > m) ? m - 1 : m - m / k;
+    }
+    
+    // Unwind from a single person (index 0) back up to n
+    long long survivor = 0;
+    for (auto it = sizes.rbegin(); it != sizes.rend(); ++it) {
+        long long m = *it;
+        if (k > m) {
+            survivor = (survivor + k) % m;
+        } else {
+            survivor -= m % k;
+            if (survivor < 0) {
+                survivor += m;
+            } else {
+                survivor += survivor / (k - 1);
+            }
+        }
+    }
+    return survivor + 1;
+}
+
+/**
+ * Solve Josephus Problem, choosing the faster closed-form solver
+ * Time Complexity: O(min(n, k log n))
+ * Space Complexity: O(k log n) when the logarithmic solver is used, O(1) otherwise
+ */
+long long josephusSurvivor(long long n, long long k) {
+    if (n <= 0 || k <= 0) {
+        throw std::invalid_argument("n and k must be positive");
+    }
+    
+    // k log n < n  <=>  the logarithmic solver does less work
+    long long logN = 1;
+    while ((1LL << logN) < n) {
+        logN++;
+    }
+    if (k < n / logN) {
+        return josephusLogarithmic(n, k);
+    }
+    return josephusLinear(n, k);
+}
+
+/**
+ * Solve Josephus Problem (1-based survivor)
+ * Time Complexity: O(min(n, k log n))
+ * Space Complexity: O(k log n)
+ */
+int josephusProblem(int n, int k) {
+    return static_cast<int>(josephusSurvivor(n, k));
+}
+
+/**
+ * Full Josephus elimination order (1-based, survivor last)
+ * A Fenwick tree over the circle holds 1 for every person still alive;
+ * the next victim is found by its rank among the survivors with a
+ * binary-lifting descent instead of walking the circle.
+ * Time Complexity: O(n log n)
+ * Space Complexity: O(n)
+ */
+std::vector<int> josephusEliminationOrder(int n, int k) {
+    if (n <= 0 || k <= 0) {
+        throw std::invalid_argument("n and k must be positive");
+    }
+    
+    // Linear-time build of a Fenwick tree over n ones
+    std::vector<int> tree(n + 1, 0);
+    for (int i = 1; i <= n; i++) {
+        tree[i]++;
+        int parent = i + (i & -i);
+        if (parent <= n) {
+            tree[parent] += tree[i];
+        }
+    }
+    int highBit = 1;
+    while (highBit * 2 <= n) {
+        highBit *= 2;
+    }
+    
+    std::vector<int> order;
+    order.reserve(n);
+    long long rank = 0;  // 0-based rank of the next counting position
+    for (int remaining = n; remaining > 0; remaining--) {
+        rank = (rank + k - 1) % remaining;
+        
+        // Find the smallest index whose prefix count exceeds rank
+        int position = 0;
+        int target = static_cast<int>(rank) + 1;
+        for (int step = highBit; step > 0; step >>= 1) {
+            int next = position + step;
+            if (next <= n && tree[next] < target) {
+                position = next;
+                target -= tree[next];
+            }
+        }
+        int victim = position + 1;
+        order.push_back(victim);
+        
+        for (int i = victim; i <= n; i += i & -i) {
+            tree[i]--;
+        }
+    }
+    
+    return order;
+}
+
 /**
  * Generate binary numbers from 1 to n using queue
  * Time Complexity: O(n)
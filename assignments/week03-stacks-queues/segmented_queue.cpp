@@ -0,0 +1,410 @@
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * Segmented Queue (block list)
+ * Queue<T>::resize doubles the array and copies every element, so a single
+ * enqueue can stall for time proportional to the queue length. A
+ * SegmentedQueue instead links fixed-size blocks: growing means linking
+ * one more block, and no element is ever moved. Blocks emptied at either
+ * end go to a free list and are reused before any new allocation.
+ *
+ * Blocks are doubly linked, so the container also works as a deque
+ * (enqueueFront / dequeueRear) and reverseFirstK can walk inwards from
+ * both ends of the prefix and swap in place.
+ *
+ * Same API as Queue<T> (enqueue, dequeue, front, rear, size, ...).
+ * getCapacity counts the slots in every block owned, including the free
+ * list; isFull therefore only reports that the next enqueue needs a block.
+ */
+
+template<typename T, int BlockSize = (sizeof(T) < 256 ? static_cast<int>(4096 / sizeof(T)) : 16)>
+class SegmentedQueue {
+private:
+    struct Block {
+        T items[BlockSize];
+        Block* next;
+        Block* prev;
+    };
+
+    Block* headBlock;
+    Block* tailBlock;
+    int headIndex;     // slot of the front element in headBlock
+    int tailIndex;     // slot one past the rear element in tailBlock
+    int currentSize;
+    Block* freeList;
+    int freeBlocks;
+    int totalBlocks;
+    static const int DEFAULT_CAPACITY = 10;
+
+    Block* acquireBlock() {
+        Block* block;
+        if (freeList != nullptr) {
+            block = freeList;
+            freeList = block->next;
+            freeBlocks--;
+        } else {
+            block = new Block;
+            totalBlocks++;
+        }
+        block->next = nullptr;
+        block->prev = nullptr;
+        return block;
+    }
+
+    void releaseBlock(Block* block) {
+        block->next = freeList;
+        freeList = block;
+        freeBlocks++;
+    }
+
+    // Keep a single block with both cursors at slot 0 whenever the queue drains
+    void resetIfEmpty() {
+        if (currentSize != 0) {
+            return;
+        }
+        if (headBlock != tailBlock) {
+            releaseBlock(tailBlock);
+            headBlock->next = nullptr;
+            tailBlock = headBlock;
+        }
+        headIndex = 0;
+        tailIndex = 0;
+    }
+
+    void initialize(int initialCapacity) {
+        if (initialCapacity <= 0) {
+            throw std::invalid_argument("Capacity must be positive");
+        }
+        freeList = nullptr;
+        freeBlocks = 0;
+        totalBlocks = 0;
+        headBlock = tailBlock = acquireBlock();
+        headIndex = tailIndex = 0;
+        currentSize = 0;
+
+        int blocks = (initialCapacity + BlockSize - 1) / BlockSize;
+        for (int i = 1; i < blocks; i++) {
+            releaseBlock(new Block);
+            totalBlocks++;
+        }
+    }
+
+    void destroy() {
+        Block* block = headBlock;
+        while (block != nullptr) {
+            Block* next = block->next;
+            delete block;
+            block = next;
+        }
+        shrinkToFit();
+    }
+
+    void copyFrom(const SegmentedQueue& other) {
+        const Block* block = other.headBlock;
+        int index = other.headIndex;
+        for (int i = 0; i < other.currentSize; i++) {
+            if (index == BlockSize) {
+                block = block->next;
+                index = 0;
+            }
+            enqueue(block->items[index++]);
+        }
+    }
+
+public:
+    /**
+     * Constructor - Initialize empty queue with room for initialCapacity elements
+     * Time Complexity: O(capacity / BlockSize)
+     * Space Complexity: O(capacity)
+     */
+    SegmentedQueue(int initialCapacity = DEFAULT_CAPACITY) {
+        initialize(initialCapacity);
+    }
+
+    /**
+     * Copy Constructor
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    SegmentedQueue(const SegmentedQueue& other) {
+        initialize(DEFAULT_CAPACITY);
+        copyFrom(other);
+    }
+
+    /**
+     * Assignment Operator
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    SegmentedQueue& operator=(const SegmentedQueue& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - Free every block, including the free list
+     * Time Complexity: O(blocks)
+     * Space Complexity: O(1)
+     */
+    ~SegmentedQueue() {
+        destroy();
+    }
+
+    /**
+     * Add element to rear of queue
+     * Time Complexity: O(1) worst case (at most one block allocation)
+     * Space Complexity: O(1)
+     */
+    void enqueue(const T& element) {
+        if (tailIndex == BlockSize) {
+            Block* block = acquireBlock();
+            block->prev = tailBlock;
+            tailBlock->next = block;
+            tailBlock = block;
+            tailIndex = 0;
+        }
+        tailBlock->items[tailIndex++] = element;
+        currentSize++;
+    }
+
+    /**
+     * Add element to front of queue
+     * Time Complexity: O(1) worst case
+     * Space Complexity: O(1)
+     */
+    void enqueueFront(const T& element) {
+        if (headIndex == 0) {
+            Block* block = acquireBlock();
+            block->next = headBlock;
+            headBlock->prev = block;
+            headBlock = block;
+            headIndex = BlockSize;
+        }
+        headBlock->items[--headIndex] = element;
+        currentSize++;
+    }
+
+    /**
+     * Remove and return front element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T dequeue() {
+        if (isEmpty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+
+        T frontElement = std::move(headBlock->items[headIndex++]);
+        currentSize--;
+        if (headIndex == BlockSize && headBlock != tailBlock) {
+            Block* drained = headBlock;
+            headBlock = drained->next;
+            headBlock->prev = nullptr;
+            releaseBlock(drained);
+            headIndex = 0;
+        }
+        resetIfEmpty();
+        return frontElement;
+    }
+
+    /**
+     * Remove and return rear element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T dequeueRear() {
+        if (isEmpty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+
+        if (tailIndex == 0) {
+            Block* drained = tailBlock;
+            tailBlock = drained->prev;
+            tailBlock->next = nullptr;
+            releaseBlock(drained);
+            tailIndex = BlockSize;
+        }
+        T rearElement = std::move(tailBlock->items[--tailIndex]);
+        currentSize--;
+        resetIfEmpty();
+        return rearElement;
+    }
+
+    /**
+     * Get front element without removing
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T front() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        return headBlock->items[headIndex];
+    }
+
+    /**
+     * Get rear element without removing
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T rear() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Queue is empty");
+        }
+        if (tailIndex == 0) {
+            return tailBlock->prev->items[BlockSize - 1];
+        }
+        return tailBlock->items[tailIndex - 1];
+    }
+
+    /**
+     * Reverse the first k elements in place
+     * Two cursors walk towards each other from both ends of the prefix and
+     * swap; the remaining n - k elements are not touched.
+     * Time Complexity: O(k)
+     * Space Complexity: O(1)
+     */
+    void reverseFirstK(int k) {
+        if (k <= 0 || k > currentSize) {
+            throw std::invalid_argument("Invalid value of k");
+        }
+
+        Block* leftBlock = headBlock;
+        int leftIndex = headIndex;
+        Block* rightBlock = headBlock;
+        int rightIndex = headIndex + k - 1;
+        while (rightIndex >= BlockSize) {
+            rightBlock = rightBlock->next;
+            rightIndex -= BlockSize;
+        }
+
+        for (int i = 0; i < k / 2; i++) {
+            std::swap(leftBlock->items[leftIndex], rightBlock->items[rightIndex]);
+            if (++leftIndex == BlockSize) {
+                leftBlock = leftBlock->next;
+                leftIndex = 0;
+            }
+            if (--rightIndex < 0) {
+                rightBlock = rightBlock->prev;
+                rightIndex = BlockSize - 1;
+            }
+        }
+    }
+
+    /**
+     * Check if queue is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    /**
+     * Check if every owned slot is in use (the next enqueue links a new block)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isFull() const {
+        return currentSize == getCapacity();
+    }
+
+    /**
+     * Get number of elements in queue
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        return currentSize;
+    }
+
+    /**
+     * Get number of slots in all owned blocks
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getCapacity() const {
+        return totalBlocks * BlockSize;
+    }
+
+    /**
+     * Number of recycled blocks waiting on the free list
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getFreeBlocks() const {
+        return freeBlocks;
+    }
+
+    /**
+     * Clear all elements, keeping their blocks for reuse
+     * Time Complexity: O(blocks)
+     * Space Complexity: O(1)
+     */
+    void clear() {
+        while (headBlock != tailBlock) {
+            Block* drained = headBlock;
+            headBlock = drained->next;
+            releaseBlock(drained);
+        }
+        headBlock->prev = nullptr;
+        headIndex = 0;
+        tailIndex = 0;
+        currentSize = 0;
+    }
+
+    /**
+     * Return free-list blocks to the allocator
+     * Time Complexity: O(free blocks)
+     * Space Complexity: O(1)
+     */
+    void shrinkToFit() {
+        while (freeList != nullptr) {
+            Block* next = freeList->next;
+            delete freeList;
+            freeList = next;
+            totalBlocks--;
+        }
+        freeBlocks = 0;
+    }
+
+    /**
+     * Display queue contents (for debugging)
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Queue is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Queue (front to rear): ";
+        const Block* block = headBlock;
+        int index = headIndex;
+        for (int i = 0; i < currentSize; i++) {
+            if (index == BlockSize) {
+                block = block->next;
+                index = 0;
+            }
+            std::cout << block->items[index++];
+            if (i < currentSize - 1) std::cout << " -> ";
+        }
+        std::cout << std::endl;
+    }
+};
+
+/**
+ * Reverse first k elements of a segmented queue in place
+ * Time Complexity: O(k)
+ * Space Complexity: O(1)
+ */
+template<typename T, int BlockSize>
+void reverseFirstKElements(SegmentedQueue<T, BlockSize>& queue, int k) {
+    queue.reverseFirstK(k);
+}
@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "monoids.h"
+
+/**
+ * Streaming Sliding-Window Aggregates
+ * slidingWindowMaximum needs the whole input up front and is specific to
+ * max. SlidingWindow<Agg> accepts one value (or one batch) at a time and
+ * answers the aggregate of the most recent values for any monoid.
+ *
+ * Two-stacks algorithm on a fixed ring buffer:
+ *
+ *   head          mid                 tail
+ *    | front stack | back stack        |
+ *    [ a3  a2  a1 ][ v4  v5  v6 ... ]
+ *
+ * Front slots hold suffix aggregates (a_i = v_i + ... + v_mid-1), so the
+ * oldest value can be dropped in O(1). The back part only keeps a running
+ * aggregate of the values pushed since the last flip. When the front runs
+ * out, the back part is flipped into suffix aggregates in one pass. Every
+ * value is flipped at most once, giving amortized O(1) push/pop/query with
+ * exactly one combine per value per flip.
+ *
+ * An aggregator describes a monoid (see monoids.h): value_type, identity()
+ * and an associative combine(older, newer). Commutativity is not required.
+ */
+
+template<typename Agg>
+class SlidingWindow {
+public:
+    using T = typename Agg::value_type;
+
+private:
+    std::vector<T> values;
+    std::vector<T> aggregates;   // suffix aggregates for slots in [head, mid)
+    std::vector<long long> timestamps;
+    size_t mask;
+    size_t head;                 // absolute positions, slot = position & mask
+    size_t mid;
+    size_t tail;
+    int capacity;
+    T backAggregate;             // aggregate of slots in [mid, tail)
+    Agg agg;
+
+    void flip() {
+        if (tail == mid) {
+            return;
+        }
+        size_t position = tail - 1;
+        aggregates[position & mask] = values[position & mask];
+        while (position != mid) {
+            position--;
+            aggregates[position & mask] = agg.combine(values[position & mask], aggregates[(position + 1) & mask]);
+        }
+        mid = tail;
+        backAggregate = agg.identity();
+    }
+
+    void append(const T& value, long long timestamp) {
+        values[tail & mask] = value;
+        timestamps[tail & mask] = timestamp;
+        backAggregate = agg.combine(backAggregate, value);
+        tail++;
+    }
+
+public:
+    /**
+     * Constructor - Window over the most recent windowSize values
+     * Time Complexity: O(windowSize)
+     * Space Complexity: O(windowSize)
+     */
+    explicit SlidingWindow(int windowSize, Agg aggregator = Agg())
+        : head(0), mid(0), tail(0), capacity(windowSize), agg(aggregator) {
+        if (windowSize <= 0) {
+            throw std::invalid_argument("Window size must be positive");
+        }
+        size_t storage = 1;
+        while (storage < static_cast<size_t>(windowSize)) {
+            storage <<= 1;
+        }
+        mask = storage - 1;
+        values.resize(storage);
+        aggregates.resize(storage);
+        timestamps.resize(storage);
+        backAggregate = agg.identity();
+    }
+
+    /**
+     * Push a value, evicting the oldest one when the window is full
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    void push(const T& value) {
+        if (isFull()) {
+            pop();
+        }
+        append(value, 0);
+    }
+
+    /**
+     * Push a value stamped with a (non-decreasing) timestamp
+     * Unlike push, a full window is an error: dropping a value that is still
+     * inside its time range would silently corrupt the aggregate.
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    void pushTimed(long long timestamp, const T& value) {
+        if (isFull()) {
+            throw std::overflow_error("Window capacity exceeded");
+        }
+        if (!isEmpty() && timestamp < timestamps[(tail - 1) & mask]) {
+            throw std::invalid_argument("Timestamps must be non-decreasing");
+        }
+        append(value, timestamp);
+    }
+
+    /**
+     * Push a batch of values in order
+     * A batch at least as long as the window replaces the contents with its
+     * last windowSize values in a single suffix-aggregate pass.
+     * Time Complexity: O(count)
+     * Space Complexity: O(1)
+     */
+    void pushMany(const T* batch, size_t count) {
+        if (count >= static_cast<size_t>(capacity)) {
+            clear();
+            const T* start = batch + (count - capacity);
+            for (int i = 0; i < capacity; i++) {
+                values[i & mask] = start[i];
+                timestamps[i & mask] = 0;
+            }
+            tail = capacity;
+            flip();
+            return;
+        }
+        for (size_t i = 0; i < count; i++) {
+            push(batch[i]);
+        }
+    }
+
+    void pushMany(const std::vector<T>& batch) {
+        pushMany(batch.data(), batch.size());
+    }
+
+    /**
+     * Remove the oldest value
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    T pop() {
+        if (isEmpty()) {
+            throw std::underflow_error("Window is empty");
+        }
+        if (head == mid) {
+            flip();
+        }
+        T value = values[head & mask];
+        head++;
+        return value;
+    }
+
+    /**
+     * Remove every value stamped before the given time
+     * Time Complexity: O(evicted) amortized
+     * Space Complexity: O(1)
+     */
+    int evictBefore(long long timestamp) {
+        int evicted = 0;
+        while (!isEmpty() && timestamps[head & mask] < timestamp) {
+            pop();
+            evicted++;
+        }
+        return evicted;
+    }
+
+    /**
+     * Aggregate of all values in the window, oldest first
+     * Returns Agg::identity() for an empty window.
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T query() const {
+        if (head == mid) {
+            return backAggregate;
+        }
+        return agg.combine(aggregates[head & mask], backAggregate);
+    }
+
+    /**
+     * Oldest and newest values in the window
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T oldest() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Window is empty");
+        }
+        return values[head & mask];
+    }
+
+    T newest() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Window is empty");
+        }
+        return values[(tail - 1) & mask];
+    }
+
+    bool isEmpty() const {
+        return head == tail;
+    }
+
+    bool isFull() const {
+        return tail - head == static_cast<size_t>(capacity);
+    }
+
+    int size() const {
+        return static_cast<int>(tail - head);
+    }
+
+    int getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * Clear all values from the window
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    void clear() {
+        head = mid = tail = 0;
+        backAggregate = agg.identity();
+    }
+};
+
+/**
+ * Time-Based Sliding Window
+ * Aggregates values whose timestamps lie in (now - duration, now]. maxEvents
+ * bounds how many values may be inside one window at a time.
+ */
+template<typename Agg>
+class TimeWindow {
+public:
+    using T = typename Agg::value_type;
+
+private:
+    SlidingWindow<Agg> window;
+    long long duration;
+
+public:
+    /**
+     * Constructor
+     * Time Complexity: O(maxEvents)
+     * Space Complexity: O(maxEvents)
+     */
+    TimeWindow(long long windowDuration, int maxEvents, Agg aggregator = Agg())
+        : window(maxEvents, aggregator), duration(windowDuration) {
+        if (windowDuration <= 0) {
+            throw std::invalid_argument("Window duration must be positive");
+        }
+    }
+
+    /**
+     * Record a value at a (non-decreasing) time and expire old values
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    void push(long long timestamp, const T& value) {
+        window.evictBefore(timestamp - duration + 1);
+        window.pushTimed(timestamp, value);
+    }
+
+    /**
+     * Aggregate of the values in (now - duration, now]
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    T query(long long now) {
+        window.evictBefore(now - duration + 1);
+        return window.query();
+    }
+
+    int size() const {
+        return window.size();
+    }
+
+    bool isEmpty() const {
+        return window.isEmpty();
+    }
+};
+
+/**
+ * Aggregate of every full window of size k, like slidingWindowMaximum
+ * Time Complexity: O(n)
+ * Space Complexity: O(k)
+ */
+template<typename Agg>
+std::vector<typename Agg::value_type> slidingWindowAggregate(const std::vector<typename Agg::value_type>& nums,
+                                                            int k, Agg aggregator = Agg()) {
+    std::vector<typename Agg::value_type> result;
+    SlidingWindow<Agg> window(k, aggregator);
+
+    for (size_t i = 0; i < nums.size(); i++) {
+        window.push(nums[i]);
+        if (window.isFull()) {
+            result.push_back(window.query());
+        }
+    }
+    return result;
+}
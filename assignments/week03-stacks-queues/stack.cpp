@@ -175,14 +175,18 @@ public:
 // Stack Applications
 
 /**
- * Check if parentheses are balanced in an expression
+ * Find the first position where bracket matching fails
+ * Returns the index of the first closing bracket that has no matching
+ * opener, expression.length() if openers are left unclosed, or -1 if the
+ * expression is balanced.
  * Time Complexity: O(n)
  * Space Complexity: O(n)
  */
-bool isBalanced(const std::string& expression) {
+long long findUnbalancedPosition(const std::string& expression) {
     Stack<char> stack;
     
-    for (char ch : expression) {
+    for (size_t i = 0; i < expression.length(); i++) {
+        char ch = expression[i];
         // Push opening brackets
         if (ch == '(' || ch == '[' || ch == '{') {
             stack.push(ch);
@@ -190,19 +194,28 @@ bool isBalanced(const std::string& expression) {
         // Check closing brackets
         else if (ch == ')' || ch == ']' || ch == '}') {
             if (stack.isEmpty()) {
-                return false;
+                return static_cast<long long>(i);
             }
             
             char top = stack.pop();
             if ((ch == ')' && top != '(') ||
                 (ch == ']' && top != '[') ||
                 (ch == '}' && top != '{')) {
-                return false;
+                return static_cast<long long>(i);
             }
         }
     }
     
-    return stack.isEmpty();
+    return stack.isEmpty() ? -1 : static_cast<long long>(expression.length());
+}
+
+/**
+ * Check if parentheses are balanced in an expression
+ * Time Complexity: O(n)
+ * Space Complexity: O(n)
+ */
+bool isBalanced(const std::string& expression) {
+    return findUnbalancedPosition(expression) == -1;
 }
 
 /**
@@ -337,9 +350,16 @@ int evaluatePostfix(const std::string& postfix) {
                     result = operand1 % operand2;
                     break;
                 case '^':
+                    // Exponentiation by squaring: O(log exponent) multiplications
                     result = 1;
-                    for (int i = 0; i < operand2; i++) {
-                        result *= operand1;
+                    while (operand2 > 0) {
+                        if (operand2 & 1) {
+                            result *= operand1;
+                        }
+                        operand2 >>= 1;
+                        if (operand2 > 0) {
+                            operand1 *= operand1;
+                        }
                     }
                     break;
                 default:
@@ -0,0 +1,230 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Chase-Lev Work-Stealing Deque
+ * The owning thread pushes and pops at the bottom (LIFO, good locality),
+ * while any number of thief threads steal from the top (FIFO) with a CAS.
+ *
+ * Storage is the same circular array layout as Queue<T>: logical positions
+ * top..bottom-1 map to buffer[position & mask]. When the owner runs out of
+ * room the array doubles; old arrays are retired rather than freed because
+ * a slow thief may still be reading from them, and are released together
+ * with the deque.
+ *
+ * Follows the C11 formulation of Le, Pop, Cohen and Zappa Nardelli (2013).
+ * Elements are stored in atomics, so T must be trivially copyable
+ * (task pointers, indices, small structs).
+ */
+
+template<typename T>
+class WorkStealingDeque {
+private:
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque elements must be trivially copyable");
+
+    static const int DEFAULT_CAPACITY = 64;
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    struct CircularArray {
+        int64_t capacity;
+        int64_t mask;
+        std::atomic<T>* buffer;
+
+        CircularArray(int64_t size) : capacity(size), mask(size - 1) {
+            buffer = new std::atomic<T>[size];
+        }
+
+        ~CircularArray() {
+            delete[] buffer;
+        }
+
+        T get(int64_t position) const {
+            return buffer[position & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t position, const T& element) {
+            buffer[position & mask].store(element, std::memory_order_relaxed);
+        }
+
+        /**
+         * Copy live range top..bottom-1 into an array twice as large
+         * Time Complexity: O(n)
+         * Space Complexity: O(capacity)
+         */
+        CircularArray* grow(int64_t top, int64_t bottom) const {
+            CircularArray* bigger = new CircularArray(capacity * 2);
+            for (int64_t i = top; i < bottom; i++) {
+                bigger->put(i, get(i));
+            }
+            return bigger;
+        }
+    };
+
+    // Thieves hammer top while the owner mostly touches bottom
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom;
+    std::atomic<CircularArray*> array;
+    std::vector<CircularArray*> retired;  // owner-only
+
+    static int64_t roundUpToPowerOfTwo(int64_t value) {
+        int64_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+public:
+    /**
+     * Constructor - capacity is rounded up to the next power of two
+     * Time Complexity: O(capacity)
+     * Space Complexity: O(capacity)
+     */
+    WorkStealingDeque(int initialCapacity = DEFAULT_CAPACITY) : top(0), bottom(0) {
+        if (initialCapacity <= 0) {
+            throw std::invalid_argument("Capacity must be positive");
+        }
+        array.store(new CircularArray(roundUpToPowerOfTwo(initialCapacity)),
+                    std::memory_order_relaxed);
+    }
+
+    // Shared between threads by reference; copying would break the protocol
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * Destructor - release current and retired arrays
+     * Time Complexity: O(number of resizes)
+     * Space Complexity: O(1)
+     */
+    ~WorkStealingDeque() {
+        delete array.load(std::memory_order_relaxed);
+        for (CircularArray* old : retired) {
+            delete old;
+        }
+    }
+
+    /**
+     * Push element at the bottom (owner thread only)
+     * Time Complexity: O(1) amortized, O(n) when the array grows
+     * Space Complexity: O(1) amortized
+     */
+    void push(const T& element) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        CircularArray* a = array.load(std::memory_order_relaxed);
+
+        if (b - t > a->capacity - 1) {
+            CircularArray* bigger = a->grow(t, b);
+            retired.push_back(a);
+            array.store(bigger, std::memory_order_release);
+            a = bigger;
+        }
+
+        a->put(b, element);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Pop element from the bottom (owner thread only)
+     * Returns false if the deque is empty or a thief took the last element
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool tryPop(T& result) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        CircularArray* a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Deque was already empty: restore bottom
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        result = a->get(b);
+        if (t == b) {
+            // Last element: race against thieves for it
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * Steal element from the top (any thread)
+     * Returns false if the deque looked empty or another thread won the race;
+     * callers normally move on to another victim
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool trySteal(T& result) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return false;
+        }
+
+        CircularArray* a = array.load(std::memory_order_acquire);
+        T element = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            return false;
+        }
+        result = element;
+        return true;
+    }
+
+    /**
+     * Pop element from the bottom, throwing if nothing is left (owner thread only)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T pop() {
+        T result;
+        if (!tryPop(result)) {
+            throw std::underflow_error("Deque is empty");
+        }
+        return result;
+    }
+
+    /**
+     * Get number of elements (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int size() const {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<int>(b - t) : 0;
+    }
+
+    /**
+     * Check if deque is empty (snapshot)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Get current capacity of the circular array
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getCapacity() const {
+        return static_cast<int>(array.load(std::memory_order_relaxed)->capacity);
+    }
+};
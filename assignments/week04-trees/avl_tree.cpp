@@ -3,11 +3,23 @@
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <utility>
+#include "node_arena.h"
+#include "order_statistics.h"
+#include "frozen_tree.h"
+#include "tree_iterator.h"
 
 /**
  * AVL Tree Implementation
  * Self-balancing binary search tree where height difference 
  * between left and right subtrees is at most 1
+ * Nodes come from NodeAllocator (see node_arena.h).
+ * With OrderStatistics = true every node also keeps its subtree size, which
+ * the rotations maintain, and select/kthSmallest/rank/countInRange run in
+ * O(log n).
  */
 
 template<typename T>
@@ -16,15 +28,21 @@ struct AVLNode {
     AVLNode* left;
     AVLNode* right;
     int height;
+    int size;  // Nodes in this subtree; kept only by order-statistic trees
     
-    AVLNode(const T& value) : data(value), left(nullptr), right(nullptr), height(0) {}
+    AVLNode(const T& value) : data(value), left(nullptr), right(nullptr), height(0), size(1) {}
 };
 
-template<typename T>
+template<typename T, typename NodeAllocator = SlabArena<AVLNode<T>>, bool OrderStatistics = false>
 class AVLTree {
 private:
     AVLNode<T>* root;
     size_t nodeCount;
+    NodeAllocator allocator;
+    
+    // An AVL tree of height h holds at least Fib(h + 3) - 1 nodes, so any
+    // tree addressable with size_t is shallower than this
+    static constexpr int MAX_DEPTH = 128;
     
     /**
      * Get height of node (handles null nodes)
@@ -36,13 +54,16 @@ private:
     }
     
     /**
-     * Update height of node based on children
+     * Update height (and subtree size, if kept) of node based on children
      * Time Complexity: O(1)
      * Space Complexity: O(1)
      */
     void updateHeight(AVLNode<T>* node) {
         if (node != nullptr) {
             node->height = 1 + std::max(getHeight(node->left), getHeight(node->right));
+            if constexpr (OrderStatistics) {
+                node->size = static_cast<int>(1 + subtreeSize(node->left) + subtreeSize(node->right));
+            }
         }
     }
     
@@ -102,7 +123,395 @@ private:
     }
     
     /**
-     * Insert a node and maintain AVL property
+     * Restore the AVL property at node after one of its subtrees changed
+     * height by at most one; returns the new subtree root
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    AVLNode<T>* rebalance(AVLNode<T>* node) {
+        updateHeight(node);
+        int balance = getBalance(node);
+        
+        if (balance > 1) {
+            if (getBalance(node->left) < 0) {
+                node->left = rotateLeft(node->left);
+            }
+            return rotateRight(node);
+        }
+        if (balance < -1) {
+            if (getBalance(node->right) > 0) {
+                node->right = rotateRight(node->right);
+            }
+            return rotateLeft(node);
+        }
+        return node;
+    }
+    
+    /**
+     * Walk the recorded path bottom-up, rebalancing each ancestor, and stop
+     * at the first subtree whose height did not change. Subtree sizes above
+     * that point only need sizeDelta (+1 insert, -1 remove) added.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void retrace(AVLNode<T>** path[], int depth, int sizeDelta) {
+        while (depth > 0) {
+            AVLNode<T>** link = path[--depth];
+            AVLNode<T>* node = *link;
+            int oldHeight = node->height;
+            *link = rebalance(node);
+            if ((*link)->height == oldHeight) {
+                break;
+            }
+        }
+        if constexpr (OrderStatistics) {
+            while (depth > 0) {
+                (*path[--depth])->size += sizeDelta;
+            }
+        }
+    }
+    
+    // Subtrees smaller than this are not worth a thread
+    static constexpr size_t PARALLEL_GRAIN = 1 << 15;
+    
+    /**
+     * Build the subtree over first[0 .. count) into slots (preorder), or
+     * node by node through the allocator when slots is null
+     * Time Complexity: O(count)
+     * Space Complexity: O(log count)
+     */
+    template<typename RandomIt>
+    AVLNode<T>* buildBalanced(RandomIt first, size_t count, AVLNode<T>* slots, int threads) {
+        if (count == 0) {
+            return nullptr;
+        }
+        size_t leftCount = count / 2;
+        RandomIt middle = first + leftCount;
+        AVLNode<T>* node = slots != nullptr ? new (slots) AVLNode<T>(*middle) : allocator.create(*middle);
+        AVLNode<T>* leftSlots = slots != nullptr ? slots + 1 : nullptr;
+        AVLNode<T>* rightSlots = slots != nullptr ? slots + 1 + leftCount : nullptr;
+        
+        if (threads > 1 && count >= PARALLEL_GRAIN) {
+            std::thread worker([&]() {
+                node->left = buildBalanced(first, leftCount, leftSlots, threads / 2);
+            });
+            node->right = buildBalanced(middle + 1, count - leftCount - 1, rightSlots, threads - threads / 2);
+            worker.join();
+        } else {
+            node->left = buildBalanced(first, leftCount, leftSlots, 1);
+            node->right = buildBalanced(middle + 1, count - leftCount - 1, rightSlots, 1);
+        }
+        updateHeight(node);
+        return node;
+    }
+    
+    /**
+     * Join-based building blocks (Blelloch, Ferizovic and Sun, "Just Join
+     * for Parallel Ordered Sets"). join links two trees around a middle
+     * node, where every key on the left < the node < every key on the
+     * right; split and the set operations below are written in terms of it
+     * and never allocate: nodes are only relinked or discarded.
+     */
+    struct SplitResult {
+        AVLNode<T>* less;
+        AVLNode<T>* match;   // node equal to the key, unlinked, or nullptr
+        AVLNode<T>* greater;
+    };
+    
+    // Trees shorter than this are merged sequentially
+    static constexpr int PARALLEL_HEIGHT = 14;
+    
+    AVLNode<T>* attach(AVLNode<T>* left, AVLNode<T>* node, AVLNode<T>* right) {
+        node->left = left;
+        node->right = right;
+        updateHeight(node);
+        return node;
+    }
+    
+    /**
+     * Join when left is taller: walk down left's right spine to a subtree
+     * no more than one level taller than right, link there, and rebalance
+     * on the way back up
+     * Time Complexity: O(h(left) - h(right))
+     * Space Complexity: O(h(left) - h(right))
+     */
+    AVLNode<T>* joinRight(AVLNode<T>* left, AVLNode<T>* node, AVLNode<T>* right) {
+        AVLNode<T>* outer = left->left;
+        AVLNode<T>* inner = left->right;
+        
+        if (getHeight(inner) <= getHeight(right) + 1) {
+            AVLNode<T>* joined = attach(inner, node, right);
+            if (getHeight(joined) <= getHeight(outer) + 1) {
+                return attach(outer, left, joined);
+            }
+            return rotateLeft(attach(outer, left, rotateRight(joined)));
+        }
+        
+        AVLNode<T>* joined = joinRight(inner, node, right);
+        attach(outer, left, joined);
+        if (getHeight(joined) <= getHeight(outer) + 1) {
+            return left;
+        }
+        return rotateLeft(left);
+    }
+    
+    AVLNode<T>* joinLeft(AVLNode<T>* left, AVLNode<T>* node, AVLNode<T>* right) {
+        AVLNode<T>* outer = right->right;
+        AVLNode<T>* inner = right->left;
+        
+        if (getHeight(inner) <= getHeight(left) + 1) {
+            AVLNode<T>* joined = attach(left, node, inner);
+            if (getHeight(joined) <= getHeight(outer) + 1) {
+                return attach(joined, right, outer);
+            }
+            return rotateRight(attach(rotateLeft(joined), right, outer));
+        }
+        
+        AVLNode<T>* joined = joinLeft(left, node, inner);
+        attach(joined, right, outer);
+        if (getHeight(joined) <= getHeight(outer) + 1) {
+            return right;
+        }
+        return rotateRight(right);
+    }
+    
+    /**
+     * Link left, node and right into one balanced tree
+     * Time Complexity: O(|h(left) - h(right)| + 1)
+     * Space Complexity: O(|h(left) - h(right)| + 1)
+     */
+    AVLNode<T>* joinNodes(AVLNode<T>* left, AVLNode<T>* node, AVLNode<T>* right) {
+        if (getHeight(left) > getHeight(right) + 1) {
+            return joinRight(left, node, right);
+        }
+        if (getHeight(right) > getHeight(left) + 1) {
+            return joinLeft(left, node, right);
+        }
+        return attach(left, node, right);
+    }
+    
+    /**
+     * Join without a middle node: the maximum of left takes that role
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n)
+     */
+    AVLNode<T>* joinTwo(AVLNode<T>* left, AVLNode<T>* right) {
+        if (left == nullptr) {
+            return right;
+        }
+        AVLNode<T>* last = nullptr;
+        AVLNode<T>* rest = splitLast(left, last);
+        return joinNodes(rest, last, right);
+    }
+    
+    AVLNode<T>* splitLast(AVLNode<T>* node, AVLNode<T>*& last) {
+        if (node->right == nullptr) {
+            last = node;
+            return node->left;
+        }
+        AVLNode<T>* rest = splitLast(node->right, last);
+        return joinNodes(node->left, node, rest);
+    }
+    
+    /**
+     * Split node's subtree into keys < key, the node equal to key, and
+     * keys > key
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n)
+     */
+    SplitResult splitNodes(AVLNode<T>* node, const T& key) {
+        if (node == nullptr) {
+            return {nullptr, nullptr, nullptr};
+        }
+        AVLNode<T>* left = node->left;
+        AVLNode<T>* right = node->right;
+        
+        if (key < node->data) {
+            SplitResult result = splitNodes(left, key);
+            result.greater = joinNodes(result.greater, node, right);
+            return result;
+        }
+        if (node->data < key) {
+            SplitResult result = splitNodes(right, key);
+            result.less = joinNodes(left, node, result.less);
+            return result;
+        }
+        node->left = nullptr;
+        node->right = nullptr;
+        return {left, node, right};
+    }
+    
+    /**
+     * Run leftTask and rightTask, on two threads when the inputs are large
+     * and the thread budget allows. Each side records the subtrees it
+     * drops in its own list, merged after the join.
+     */
+    template<typename LeftTask, typename RightTask>
+    void forkJoin(bool large, int threads, std::vector<AVLNode<T>*>& discarded,
+                  LeftTask leftTask, RightTask rightTask) {
+        if (threads > 1 && large) {
+            std::vector<AVLNode<T>*> leftDiscarded;
+            std::thread worker([&]() { leftTask(threads / 2, leftDiscarded); });
+            rightTask(threads - threads / 2, discarded);
+            worker.join();
+            discarded.insert(discarded.end(), leftDiscarded.begin(), leftDiscarded.end());
+        } else {
+            leftTask(threads, discarded);
+            rightTask(threads, discarded);
+        }
+    }
+    
+    bool isLarge(AVLNode<T>* a, AVLNode<T>* b) const {
+        return std::min(getHeight(a), getHeight(b)) >= PARALLEL_HEIGHT;
+    }
+    
+    /**
+     * Union: b's root splits a; the halves are merged recursively and
+     * joined around it. Keys found in both keep b's node.
+     * Time Complexity: O(m log(n / m + 1)) work, O(log^2 n) span
+     * Space Complexity: O(log^2 n)
+     */
+    AVLNode<T>* unionNodes(AVLNode<T>* a, AVLNode<T>* b, int threads, std::vector<AVLNode<T>*>& discarded) {
+        if (a == nullptr) return b;
+        if (b == nullptr) return a;
+        
+        AVLNode<T>* bLeft = b->left;
+        AVLNode<T>* bRight = b->right;
+        SplitResult parts = splitNodes(a, b->data);
+        if (parts.match != nullptr) {
+            discarded.push_back(parts.match);
+        }
+        
+        AVLNode<T>* left = nullptr;
+        AVLNode<T>* right = nullptr;
+        forkJoin(isLarge(parts.less, bLeft) && isLarge(parts.greater, bRight), threads, discarded,
+                 [&](int t, std::vector<AVLNode<T>*>& d) { left = unionNodes(parts.less, bLeft, t, d); },
+                 [&](int t, std::vector<AVLNode<T>*>& d) { right = unionNodes(parts.greater, bRight, t, d); });
+        return joinNodes(left, b, right);
+    }
+    
+    /**
+     * Intersection: keys of b that a also contains (b's nodes are kept)
+     * Time Complexity: O(m log(n / m + 1)) work, O(log^2 n) span
+     * Space Complexity: O(log^2 n)
+     */
+    AVLNode<T>* intersectNodes(AVLNode<T>* a, AVLNode<T>* b, int threads, std::vector<AVLNode<T>*>& discarded) {
+        if (a == nullptr || b == nullptr) {
+            if (a != nullptr) discarded.push_back(a);
+            if (b != nullptr) discarded.push_back(b);
+            return nullptr;
+        }
+        
+        AVLNode<T>* bLeft = b->left;
+        AVLNode<T>* bRight = b->right;
+        SplitResult parts = splitNodes(a, b->data);
+        
+        AVLNode<T>* left = nullptr;
+        AVLNode<T>* right = nullptr;
+        forkJoin(isLarge(parts.less, bLeft) && isLarge(parts.greater, bRight), threads, discarded,
+                 [&](int t, std::vector<AVLNode<T>*>& d) { left = intersectNodes(parts.less, bLeft, t, d); },
+                 [&](int t, std::vector<AVLNode<T>*>& d) { right = intersectNodes(parts.greater, bRight, t, d); });
+        
+        if (parts.match != nullptr) {
+            discarded.push_back(parts.match);
+            return joinNodes(left, b, right);
+        }
+        discarded.push_back(attach(nullptr, b, nullptr));
+        return joinTwo(left, right);
+    }
+    
+    /**
+     * Difference: keys of a that b does not contain
+     * Time Complexity: O(m log(n / m + 1)) work, O(log^2 n) span
+     * Space Complexity: O(log^2 n)
+     */
+    AVLNode<T>* differenceNodes(AVLNode<T>* a, AVLNode<T>* b, int threads, std::vector<AVLNode<T>*>& discarded) {
+        if (a == nullptr || b == nullptr) {
+            if (b != nullptr) discarded.push_back(b);
+            return a;
+        }
+        
+        AVLNode<T>* bLeft = b->left;
+        AVLNode<T>* bRight = b->right;
+        SplitResult parts = splitNodes(a, b->data);
+        if (parts.match != nullptr) {
+            discarded.push_back(parts.match);
+        }
+        discarded.push_back(attach(nullptr, b, nullptr));
+        
+        AVLNode<T>* left = nullptr;
+        AVLNode<T>* right = nullptr;
+        forkJoin(isLarge(parts.less, bLeft) && isLarge(parts.greater, bRight), threads, discarded,
+                 [&](int t, std::vector<AVLNode<T>*>& d) { left = differenceNodes(parts.less, bLeft, t, d); },
+                 [&](int t, std::vector<AVLNode<T>*>& d) { right = differenceNodes(parts.greater, bRight, t, d); });
+        return joinTwo(left, right);
+    }
+    
+    /**
+     * Destroy dropped subtrees after a set operation; returns how many
+     * nodes were destroyed
+     * Time Complexity: O(dropped nodes)
+     * Space Complexity: O(log n)
+     */
+    size_t destroySubtrees(const std::vector<AVLNode<T>*>& subtrees) {
+        size_t destroyed = 0;
+        for (AVLNode<T>* subtree : subtrees) {
+            destroyed += countNodes(subtree);
+            makeEmpty(subtree);
+        }
+        return destroyed;
+    }
+    
+    static size_t countNodes(AVLNode<T>* node) {
+        size_t count = 0;
+        AVLNode<T>* stack[2 * MAX_DEPTH];
+        int top = 0;
+        if (node != nullptr) {
+            stack[top++] = node;
+        }
+        while (top > 0) {
+            AVLNode<T>* current = stack[--top];
+            count++;
+            if (current->left != nullptr) stack[top++] = current->left;
+            if (current->right != nullptr) stack[top++] = current->right;
+        }
+        return count;
+    }
+    
+    /**
+     * Take over other's nodes: share its storage and leave it empty
+     */
+    AVLNode<T>* adopt(AVLTree& other) {
+        allocator.shareChunks(other.allocator);
+        AVLNode<T>* nodes = other.root;
+        other.root = nullptr;
+        other.nodeCount = 0;
+        return nodes;
+    }
+    
+    /**
+     * Throw unless every key of other is greater than every key here
+     */
+    void checkJoinable(const AVLTree& other) const {
+        if (!isEmpty() && !other.isEmpty() && !(findMax() < other.findMin())) {
+            throw std::invalid_argument("Keys of the joined tree must be greater");
+        }
+    }
+    
+    template<typename Operation>
+    void combineWith(AVLTree& other, int threads, Operation operation) {
+        if (threads <= 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        size_t total = nodeCount + other.nodeCount;
+        AVLNode<T>* otherNodes = adopt(other);
+        std::vector<AVLNode<T>*> discarded;
+        root = (this->*operation)(root, otherNodes, threads, discarded);
+        nodeCount = total - destroySubtrees(discarded);
+    }
+    
+    /**
+     * Insert a node and maintain AVL property (recursive version)
      * Time Complexity: O(log n)
      * Space Complexity: O(log n)
      */
@@ -110,7 +519,7 @@ private:
         // Step 1: Perform normal BST insertion
         if (node == nullptr) {
             nodeCount++;
-            return new AVLNode<T>(value);
+            return allocator.create(value);
         }
         
         if (value < node->data) {
@@ -169,7 +578,7 @@ private:
     }
     
     /**
-     * Remove a node and maintain AVL property
+     * Remove a node and maintain AVL property (recursive version)
      * Time Complexity: O(log n)
      * Space Complexity: O(log n)
      */
@@ -199,7 +608,7 @@ private:
                     // One child case
                     *node = *temp; // Copy contents of non-empty child
                 }
-                delete temp;
+                allocator.destroy(temp);
             } else {
                 // Node with two children
                 AVLNode<T>* temp = findMinNode(node->right);
@@ -252,7 +661,7 @@ private:
     }
     
     /**
-     * Search for a value in the tree
+     * Search for a value in the tree (recursive version)
      * Time Complexity: O(log n)
      * Space Complexity: O(log n)
      */
@@ -271,61 +680,67 @@ private:
     }
     
     /**
-     * Delete all nodes in the tree
+     * Destroy all nodes one by one
+     * Each popped node is destroyed after its children are pushed, so the
+     * stack never holds more than one pending sibling per level.
      * Time Complexity: O(n)
      * Space Complexity: O(log n)
      */
     void makeEmpty(AVLNode<T>* node) {
-        if (node != nullptr) {
-            makeEmpty(node->left);
-            makeEmpty(node->right);
-            delete node;
+        if (node == nullptr) {
+            return;
+        }
+        AVLNode<T>* stack[2 * MAX_DEPTH];
+        int top = 0;
+        stack[top++] = node;
+        while (top > 0) {
+            AVLNode<T>* current = stack[--top];
+            if (current->left != nullptr) {
+                stack[top++] = current->left;
+            }
+            if (current->right != nullptr) {
+                stack[top++] = current->right;
+            }
+            allocator.destroy(current);
         }
     }
     
     /**
-     * Clone the tree
+     * Clone the tree level by level, so that both children of a node
+     * are allocated next to each other
      * Time Complexity: O(n)
-     * Space Complexity: O(log n)
+     * Space Complexity: O(w) where w is max width
      */
-    AVLNode<T>* clone(AVLNode<T>* node) const {
+    AVLNode<T>* clone(AVLNode<T>* node) {
         if (node == nullptr) {
             return nullptr;
         }
         
-        AVLNode<T>* newNode = new AVLNode<T>(node->data);
-        newNode->height = node->height;
-        newNode->left = clone(node->left);
-        newNode->right = clone(node->right);
-        return newNode;
-    }
-    
-    /**
-     * Inorder traversal helper
-     * Time Complexity: O(n)
-     * Space Complexity: O(log n)
-     */
-    void inorderTraversal(AVLNode<T>* node, std::vector<T>& result) const {
-        if (node != nullptr) {
-            inorderTraversal(node->left, result);
-            result.push_back(node->data);
-            inorderTraversal(node->right, result);
+        AVLNode<T>* newRoot = allocator.create(node->data);
+        newRoot->height = node->height;
+        newRoot->size = node->size;
+        std::queue<std::pair<AVLNode<T>*, AVLNode<T>*>> pending;
+        pending.push({node, newRoot});
+        while (!pending.empty()) {
+            AVLNode<T>* source = pending.front().first;
+            AVLNode<T>* copy = pending.front().second;
+            pending.pop();
+            if (source->left != nullptr) {
+                copy->left = allocator.create(source->left->data);
+                copy->left->height = source->left->height;
+                copy->left->size = source->left->size;
+                pending.push({source->left, copy->left});
+            }
+            if (source->right != nullptr) {
+                copy->right = allocator.create(source->right->data);
+                copy->right->height = source->right->height;
+                copy->right->size = source->right->size;
+                pending.push({source->right, copy->right});
+            }
         }
+        return newRoot;
     }
     
-    /**
-     * Preorder traversal helper
-     * Time Complexity: O(n)
-     * Space Complexity: O(log n)
-     */
-    void preorderTraversal(AVLNode<T>* node, std::vector<T>& result) const {
-        if (node != nullptr) {
-            result.push_back(node->data);
-            preorderTraversal(node->left, result);
-            preorderTraversal(node->right, result);
-        }
-    }
-
 public:
     /**
      * Default constructor
@@ -359,37 +774,246 @@ public:
     
     /**
      * Destructor
-     * Time Complexity: O(n)
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
      * Space Complexity: O(log n)
      */
     ~AVLTree() {
         makeEmpty();
     }
     
+    /**
+     * Move constructor - takes over the nodes and their allocator
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    AVLTree(AVLTree&& other) noexcept : root(other.root), nodeCount(other.nodeCount) {
+        allocator.swap(other.allocator);
+        other.root = nullptr;
+        other.nodeCount = 0;
+    }
+    
+    /**
+     * Move assignment operator
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
+     * Space Complexity: O(1)
+     */
+    AVLTree& operator=(AVLTree&& other) noexcept {
+        if (this != &other) {
+            makeEmpty();
+            std::swap(root, other.root);
+            std::swap(nodeCount, other.nodeCount);
+            allocator.swap(other.allocator);
+        }
+        return *this;
+    }
+    
+    /**
+     * Build a perfectly balanced tree from a strictly increasing range
+     * in one pass (no comparisons or rotations beyond the order check).
+     * With an allocator that provides adjacent slots, nodes are laid out in
+     * preorder and threads > 1 builds the two halves of large subtrees
+     * concurrently; otherwise the build is sequential.
+     * Throws std::invalid_argument if the range is not strictly increasing.
+     * Time Complexity: O(n) work, O(n / threads + log n) span
+     * Space Complexity: O(log n) recursion
+     */
+    template<typename RandomIt>
+    static AVLTree fromSorted(RandomIt first, RandomIt last, int threads = 1) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        for (size_t i = 1; i < count; i++) {
+            if (!(first[i - 1] < first[i])) {
+                throw std::invalid_argument("Input must be strictly increasing");
+            }
+        }
+        if (threads <= 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        
+        AVLTree tree;
+        AVLNode<T>* slots = tree.allocator.allocateSlots(count);
+        if (slots == nullptr) {
+            threads = 1;
+        }
+        tree.root = tree.buildBalanced(first, count, slots, threads);
+        tree.nodeCount = count;
+        return tree;
+    }
+    
+    template<typename Container>
+    static AVLTree fromSorted(const Container& sorted, int threads = 1) {
+        return fromSorted(std::begin(sorted), std::end(sorted), threads);
+    }
+    
+    /**
+     * Append other, whose keys must all be greater than this tree's keys.
+     * An rvalue hands its nodes over; an lvalue is copied first, and only
+     * once the keys are known to fit.
+     * Throws std::invalid_argument otherwise (other is left unchanged).
+     * Time Complexity: O(log n), plus O(m) to copy an lvalue of size m
+     * Space Complexity: O(log n)
+     */
+    void join(AVLTree&& other) {
+        checkJoinable(other);
+        if (other.isEmpty()) {
+            return;
+        }
+        size_t total = nodeCount + other.nodeCount;
+        AVLNode<T>* right = adopt(other);
+        root = joinTwo(root, right);
+        nodeCount = total;
+    }
+    
+    void join(const AVLTree& other) {
+        checkJoinable(other);
+        join(AVLTree(other));
+    }
+    
+    /**
+     * Split at key: this tree keeps the keys < key and the returned tree
+     * holds the keys >= key. Both trees share storage afterwards.
+     * Time Complexity: O(log n) relinking, plus O(k) to count the k keys
+     *                  that move (O(1) with order statistics)
+     * Space Complexity: O(log n)
+     */
+    AVLTree split(const T& key) {
+        SplitResult parts = splitNodes(root, key);
+        AVLTree upper;
+        upper.allocator.shareChunks(allocator);
+        upper.root = parts.match != nullptr ? joinNodes(nullptr, parts.match, parts.greater) : parts.greater;
+        if constexpr (OrderStatistics) {
+            upper.nodeCount = subtreeSize(upper.root);
+        } else {
+            upper.nodeCount = countNodes(upper.root);
+        }
+        root = parts.less;
+        nodeCount -= upper.nodeCount;
+        return upper;
+    }
+    
+    /**
+     * Set union, intersection and difference with other
+     * Pass std::move(tree) to hand its nodes over (an lvalue is copied
+     * first). threads > 1 runs independent halves of large subproblems on
+     * separate threads; 0 uses hardware_concurrency.
+     * Time Complexity: O(m log(n / m + 1)) work for sizes m <= n, plus
+     *                  O(k) to free the k nodes dropped
+     * Space Complexity: O(log^2 n) plus O(k) for the dropped list
+     */
+    void unionWith(AVLTree other, int threads = 1) {
+        combineWith(other, threads, &AVLTree::unionNodes);
+    }
+    
+    void intersectWith(AVLTree other, int threads = 1) {
+        combineWith(other, threads, &AVLTree::intersectNodes);
+    }
+    
+    void differenceWith(AVLTree other, int threads = 1) {
+        combineWith(other, threads, &AVLTree::differenceNodes);
+    }
+    
     /**
      * Insert a value into the tree
+     * Descends iteratively, recording the links followed, then retraces
+     * them; at most one (single or double) rotation happens.
      * Time Complexity: O(log n)
-     * Space Complexity: O(log n)
+     * Space Complexity: O(1) (fixed-size path array)
      */
     void insert(const T& value) {
-        root = insert(root, value);
+        AVLNode<T>** path[MAX_DEPTH];
+        int depth = 0;
+        AVLNode<T>** link = &root;
+        
+        while (*link != nullptr) {
+            AVLNode<T>* node = *link;
+            if (value < node->data) {
+                path[depth++] = link;
+                link = &node->left;
+            } else if (value > node->data) {
+                path[depth++] = link;
+                link = &node->right;
+            } else {
+                return; // Duplicate values are not allowed
+            }
+        }
+        
+        *link = allocator.create(value);
+        nodeCount++;
+        retrace(path, depth, 1);
     }
     
     /**
      * Remove a value from the tree
+     * A node with two children takes its inorder successor's value and the
+     * successor is unlinked instead; then the path is retraced.
      * Time Complexity: O(log n)
-     * Space Complexity: O(log n)
+     * Space Complexity: O(1) (fixed-size path array)
      */
     void remove(const T& value) {
-        root = remove(root, value);
+        AVLNode<T>** path[MAX_DEPTH];
+        int depth = 0;
+        AVLNode<T>** link = &root;
+        
+        while (*link != nullptr && !(value == (*link)->data)) {
+            path[depth++] = link;
+            link = value < (*link)->data ? &(*link)->left : &(*link)->right;
+        }
+        if (*link == nullptr) {
+            return;
+        }
+        
+        AVLNode<T>* target = *link;
+        if (target->left != nullptr && target->right != nullptr) {
+            path[depth++] = link;
+            link = &target->right;
+            while ((*link)->left != nullptr) {
+                path[depth++] = link;
+                link = &(*link)->left;
+            }
+            AVLNode<T>* successor = *link;
+            target->data = std::move(successor->data);
+            *link = successor->right;
+            allocator.destroy(successor);
+        } else {
+            *link = target->left != nullptr ? target->left : target->right;
+            allocator.destroy(target);
+        }
+        nodeCount--;
+        retrace(path, depth, -1);
     }
     
     /**
      * Check if value exists in tree
      * Time Complexity: O(log n)
-     * Space Complexity: O(log n)
+     * Space Complexity: O(1)
      */
     bool contains(const T& value) const {
+        AVLNode<T>* node = root;
+        while (node != nullptr) {
+            if (value == node->data) {
+                return true;
+            } else if (value < node->data) {
+                node = node->left;
+            } else {
+                node = node->right;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * Recursive insert, remove and contains, kept for comparison
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) call stack
+     */
+    void insertRecursive(const T& value) {
+        root = insert(root, value);
+    }
+    
+    void removeRecursive(const T& value) {
+        root = remove(root, value);
+    }
+    
+    bool containsRecursive(const T& value) const {
         return contains(root, value);
     }
     
@@ -453,15 +1077,41 @@ public:
     
     /**
      * Remove all nodes from tree
-     * Time Complexity: O(n)
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
      * Space Complexity: O(log n)
      */
     void makeEmpty() {
-        makeEmpty(root);
+        if (!NodeAllocator::BULK_RELEASE) {
+            makeEmpty(root);
+        }
+        allocator.releaseAll();
         root = nullptr;
         nodeCount = 0;
     }
     
+    /**
+     * Re-lay out the nodes in level order in a fresh allocation,
+     * dropping the gaps left by removals
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    void compact() {
+        AVLTree copy(*this);
+        std::swap(root, copy.root);
+        allocator.swap(copy.allocator);
+    }
+    
+    /**
+     * Immutable, pointer-free snapshot of the current keys in one
+     * contiguous array (Eytzinger order, see frozen_tree.h); later changes
+     * to this tree do not affect it
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    FrozenTree<T> freeze() const {
+        return FrozenTree<T>(inorderTraversal());
+    }
+    
     /**
      * Check if tree is balanced (for testing)
      * Time Complexity: O(n)
@@ -491,7 +1141,20 @@ public:
      */
     std::vector<T> inorderTraversal() const {
         std::vector<T> result;
-        inorderTraversal(root, result);
+        result.reserve(nodeCount);
+        AVLNode<T>* stack[MAX_DEPTH];
+        int top = 0;
+        AVLNode<T>* current = root;
+        
+        while (current != nullptr || top > 0) {
+            while (current != nullptr) {
+                stack[top++] = current;
+                current = current->left;
+            }
+            current = stack[--top];
+            result.push_back(current->data);
+            current = current->right;
+        }
         return result;
     }
     
@@ -502,7 +1165,24 @@ public:
      */
     std::vector<T> preorderTraversal() const {
         std::vector<T> result;
-        preorderTraversal(root, result);
+        result.reserve(nodeCount);
+        AVLNode<T>* stack[MAX_DEPTH + 1];
+        int top = 0;
+        if (root != nullptr) {
+            stack[top++] = root;
+        }
+        
+        // Push right before left; at most one pending right sibling per level
+        while (top > 0) {
+            AVLNode<T>* current = stack[--top];
+            result.push_back(current->data);
+            if (current->right != nullptr) {
+                stack[top++] = current->right;
+            }
+            if (current->left != nullptr) {
+                stack[top++] = current->left;
+            }
+        }
         return result;
     }
     
@@ -588,7 +1268,7 @@ private:
         // Normal BST insertion
         if (node == nullptr) {
             nodeCount++;
-            return new AVLNode<T>(value);
+            return allocator.create(value);
         }
         
         if (value < node->data) {
@@ -643,6 +1323,103 @@ public:
         return result;
     }
     
+    using iterator = TreeIterator<T, AVLNode<T>, MAX_DEPTH>;
+    using const_iterator = iterator;
+    
+    /**
+     * In-order iterators over the keys; any insert or remove invalidates them.
+     * The path sits in a MAX_DEPTH array inside the iterator, so nothing
+     * is allocated
+     * Time Complexity: O(log n) for begin, O(1) for end
+     * Space Complexity: O(1) heap, MAX_DEPTH pointers inline
+     */
+    iterator begin() const {
+        return iterator::first(root);
+    }
+    
+    iterator end() const {
+        return iterator::last(root);
+    }
+    
+    /**
+     * Iterator to the first key >= value / > value, or end()
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n)
+     */
+    iterator lower_bound(const T& value) const {
+        return iterator::lowerBound(root, value);
+    }
+    
+    iterator upper_bound(const T& value) const {
+        return iterator::upperBound(root, value);
+    }
+    
+    /**
+     * Lazy view of the keys in [low, high] in sorted order: nothing is
+     * copied, and stopping early leaves the rest of the range untouched
+     * Time Complexity: O(log n) to create, O(1) amortized per key
+     * Space Complexity: O(log n)
+     */
+    TreeRange<iterator> range(const T& low, const T& high) const {
+        if (high < low) {
+            return TreeRange<iterator>(end(), end());
+        }
+        return TreeRange<iterator>(lower_bound(low), upper_bound(high));
+    }
+    
+    /**
+     * Key with exactly index smaller keys (0-indexed)
+     * Requires OrderStatistics; throws std::out_of_range past the end.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T select(size_t index) const {
+        static_assert(OrderStatistics, "select requires OrderStatistics = true");
+        if (index >= nodeCount) {
+            throw std::out_of_range("Index is out of range");
+        }
+        return selectNode(root, index)->data;
+    }
+    
+    /**
+     * Get k-th smallest element (1-indexed)
+     * Requires OrderStatistics; throws std::out_of_range for k outside [1, n].
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T kthSmallest(int k) const {
+        static_assert(OrderStatistics, "kthSmallest requires OrderStatistics = true");
+        if (k <= 0 || static_cast<size_t>(k) > nodeCount) {
+            throw std::out_of_range("k is out of range");
+        }
+        return selectNode(root, static_cast<size_t>(k - 1))->data;
+    }
+    
+    /**
+     * Number of keys smaller than key (key need not be present)
+     * Requires OrderStatistics.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    size_t rank(const T& key) const {
+        static_assert(OrderStatistics, "rank requires OrderStatistics = true");
+        return countBelow(root, key, false);
+    }
+    
+    /**
+     * Number of keys in [low, high], without materializing them
+     * Requires OrderStatistics.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    size_t countInRange(const T& low, const T& high) const {
+        static_assert(OrderStatistics, "countInRange requires OrderStatistics = true");
+        if (high < low) {
+            return 0;
+        }
+        return countBelow(root, high, true) - countBelow(root, low, false);
+    }
+    
 private:
     void rangeQuery(AVLNode<T>* node, const T& low, const T& high, std::vector<T>& result) const {
         if (node == nullptr) {
@@ -666,6 +1443,12 @@ private:
     }
 };
 
+/**
+ * AVL tree with subtree sizes (O(log n) select/kthSmallest/rank/countInRange)
+ */
+template<typename T, typename NodeAllocator = SlabArena<AVLNode<T>>>
+using OrderStatisticAVLTree = AVLTree<T, NodeAllocator, true>;
+
 // Example usage and testing
 void demonstrateAVL() {
     std::cout << "=== AVL Tree Demonstration ===" << std::endl;
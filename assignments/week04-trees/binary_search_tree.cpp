@@ -4,27 +4,42 @@
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
+#include <iterator>
+#include <new>
+#include <thread>
 #include <functional>
+#include "tree_node.h"
+#include "node_arena.h"
+#include "order_statistics.h"
+#include "tree_iterator.h"
 
 /**
  * Binary Search Tree Implementation
  * A tree data structure where left child < parent < right child
+ * Nodes come from NodeAllocator (see node_arena.h); the default slab
+ * arena lets makeEmpty release the whole tree in O(chunks).
+ * With OrderStatistics = true every node also keeps its subtree size and
+ * select/kthSmallest/rank/countInRange run in O(h).
  */
 
-template<typename T>
-struct TreeNode {
-    T data;
-    TreeNode* left;
-    TreeNode* right;
-    
-    TreeNode(const T& value) : data(value), left(nullptr), right(nullptr) {}
-};
-
-template<typename T>
+template<typename T, typename NodeAllocator = SlabArena<TreeNode<T>>, bool OrderStatistics = false>
 class BinarySearchTree {
 private:
     TreeNode<T>* root;
     size_t nodeCount;
+    NodeAllocator allocator;
+    
+    /**
+     * Recompute the subtree size of node from its children (no-op unless
+     * order statistics are kept)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    void updateSize(TreeNode<T>* node) {
+        if constexpr (OrderStatistics) {
+            node->size = static_cast<int>(1 + subtreeSize(node->left) + subtreeSize(node->right));
+        }
+    }
     
     /**
      * Helper function to insert a node recursively
@@ -34,7 +49,7 @@ private:
     TreeNode<T>* insert(TreeNode<T>* node, const T& value) {
         if (node == nullptr) {
             nodeCount++;
-            return new TreeNode<T>(value);
+            return allocator.create(value);
         }
         
         if (value < node->data) {
@@ -44,6 +59,7 @@ private:
         }
         // Duplicate values are ignored
         
+        updateSize(node);
         return node;
     }
     
@@ -67,17 +83,17 @@ private:
             
             // Case 1: Node with no children
             if (node->left == nullptr && node->right == nullptr) {
-                delete node;
+                allocator.destroy(node);
                 return nullptr;
             }
             // Case 2: Node with one child
             else if (node->left == nullptr) {
                 TreeNode<T>* temp = node->right;
-                delete node;
+                allocator.destroy(node);
                 return temp;
             } else if (node->right == nullptr) {
                 TreeNode<T>* temp = node->left;
-                delete node;
+                allocator.destroy(node);
                 return temp;
             }
             // Case 3: Node with two children
@@ -88,6 +104,7 @@ private:
                 nodeCount++; // Compensate for the decrement in recursive call
             }
         }
+        updateSize(node);
         return node;
     }
     
@@ -151,7 +168,7 @@ private:
     }
     
     /**
-     * Helper function to delete all nodes
+     * Helper function to destroy all nodes one by one
      * Time Complexity: O(n)
      * Space Complexity: O(h)
      */
@@ -159,24 +176,41 @@ private:
         if (node != nullptr) {
             makeEmpty(node->left);
             makeEmpty(node->right);
-            delete node;
+            allocator.destroy(node);
         }
     }
     
     /**
-     * Helper function to clone tree
+     * Helper function to clone tree level by level, so that both
+     * children of a node are allocated next to each other
      * Time Complexity: O(n)
-     * Space Complexity: O(h)
+     * Space Complexity: O(w) where w is maximum width
      */
-    TreeNode<T>* clone(TreeNode<T>* node) const {
+    TreeNode<T>* clone(TreeNode<T>* node) {
         if (node == nullptr) {
             return nullptr;
         }
         
-        TreeNode<T>* newNode = new TreeNode<T>(node->data);
-        newNode->left = clone(node->left);
-        newNode->right = clone(node->right);
-        return newNode;
+        TreeNode<T>* newRoot = allocator.create(node->data);
+        newRoot->size = node->size;
+        std::queue<std::pair<TreeNode<T>*, TreeNode<T>*>> pending;
+        pending.push({node, newRoot});
+        while (!pending.empty()) {
+            TreeNode<T>* source = pending.front().first;
+            TreeNode<T>* copy = pending.front().second;
+            pending.pop();
+            if (source->left != nullptr) {
+                copy->left = allocator.create(source->left->data);
+                copy->left->size = source->left->size;
+                pending.push({source->left, copy->left});
+            }
+            if (source->right != nullptr) {
+                copy->right = allocator.create(source->right->data);
+                copy->right->size = source->right->size;
+                pending.push({source->right, copy->right});
+            }
+        }
+        return newRoot;
     }
     
     /**
@@ -217,6 +251,40 @@ private:
             result.push_back(node->data);
         }
     }
+    
+    // Subtrees smaller than this are not worth a thread
+    static constexpr size_t PARALLEL_GRAIN = 1 << 15;
+    
+    /**
+     * Build the subtree over first[0 .. count) into slots (preorder), or
+     * node by node through the allocator when slots is null
+     * Time Complexity: O(count)
+     * Space Complexity: O(log count)
+     */
+    template<typename RandomIt>
+    TreeNode<T>* buildBalanced(RandomIt first, size_t count, TreeNode<T>* slots, int threads) {
+        if (count == 0) {
+            return nullptr;
+        }
+        size_t leftCount = count / 2;
+        RandomIt middle = first + leftCount;
+        TreeNode<T>* node = slots != nullptr ? new (slots) TreeNode<T>(*middle) : allocator.create(*middle);
+        TreeNode<T>* leftSlots = slots != nullptr ? slots + 1 : nullptr;
+        TreeNode<T>* rightSlots = slots != nullptr ? slots + 1 + leftCount : nullptr;
+        
+        if (threads > 1 && count >= PARALLEL_GRAIN) {
+            std::thread worker([&]() {
+                node->left = buildBalanced(first, leftCount, leftSlots, threads / 2);
+            });
+            node->right = buildBalanced(middle + 1, count - leftCount - 1, rightSlots, threads - threads / 2);
+            worker.join();
+        } else {
+            node->left = buildBalanced(first, leftCount, leftSlots, 1);
+            node->right = buildBalanced(middle + 1, count - leftCount - 1, rightSlots, 1);
+        }
+        updateSize(node);
+        return node;
+    }
 
 public:
     /**
@@ -251,13 +319,76 @@ public:
     
     /**
      * Destructor
-     * Time Complexity: O(n)
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
      * Space Complexity: O(h)
      */
     ~BinarySearchTree() {
         makeEmpty();
     }
     
+    /**
+     * Move constructor - takes over the nodes and their allocator
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    BinarySearchTree(BinarySearchTree&& other) noexcept : root(other.root), nodeCount(other.nodeCount) {
+        allocator.swap(other.allocator);
+        other.root = nullptr;
+        other.nodeCount = 0;
+    }
+    
+    /**
+     * Move assignment operator
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
+     * Space Complexity: O(1)
+     */
+    BinarySearchTree& operator=(BinarySearchTree&& other) noexcept {
+        if (this != &other) {
+            makeEmpty();
+            std::swap(root, other.root);
+            std::swap(nodeCount, other.nodeCount);
+            allocator.swap(other.allocator);
+        }
+        return *this;
+    }
+    
+    /**
+     * Build a perfectly balanced tree from a strictly increasing range
+     * in one pass (no comparisons or rotations beyond the order check).
+     * With an allocator that provides adjacent slots, nodes are laid out in
+     * preorder and threads > 1 builds the two halves of large subtrees
+     * concurrently; otherwise the build is sequential.
+     * Throws std::invalid_argument if the range is not strictly increasing.
+     * Time Complexity: O(n) work, O(n / threads + log n) span
+     * Space Complexity: O(log n) recursion
+     */
+    template<typename RandomIt>
+    static BinarySearchTree fromSorted(RandomIt first, RandomIt last, int threads = 1) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        for (size_t i = 1; i < count; i++) {
+            if (!(first[i - 1] < first[i])) {
+                throw std::invalid_argument("Input must be strictly increasing");
+            }
+        }
+        if (threads <= 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        
+        BinarySearchTree tree;
+        TreeNode<T>* slots = tree.allocator.allocateSlots(count);
+        if (slots == nullptr) {
+            threads = 1;
+        }
+        tree.root = tree.buildBalanced(first, count, slots, threads);
+        tree.nodeCount = count;
+        return tree;
+    }
+    
+    template<typename Container>
+    static BinarySearchTree fromSorted(const Container& sorted, int threads = 1) {
+        return fromSorted(std::begin(sorted), std::end(sorted), threads);
+    }
+    
     /**
      * Insert a value into the tree
      * Time Complexity: O(h) average, O(n) worst case
@@ -342,15 +473,30 @@ public:
     
     /**
      * Remove all nodes from tree
-     * Time Complexity: O(n)
+     * Time Complexity: O(chunks) with a bulk-release arena, O(n) otherwise
      * Space Complexity: O(h)
      */
     void makeEmpty() {
-        makeEmpty(root);
+        if (!NodeAllocator::BULK_RELEASE) {
+            makeEmpty(root);
+        }
+        allocator.releaseAll();
         root = nullptr;
         nodeCount = 0;
     }
     
+    /**
+     * Re-lay out the nodes in level order in a fresh allocation,
+     * dropping the gaps left by removals
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    void compact() {
+        BinarySearchTree copy(*this);
+        std::swap(root, copy.root);
+        allocator.swap(copy.allocator);
+    }
+    
     /**
      * Inorder traversal (sorted order)
      * Time Complexity: O(n)
@@ -470,6 +616,49 @@ public:
         return result;
     }
     
+    using iterator = TreeIterator<T, TreeNode<T>>;
+    using const_iterator = iterator;
+    
+    /**
+     * In-order iterators over the keys; any insert or remove invalidates them.
+     * The path is held inline up to depth 32 and on the heap below that
+     * Time Complexity: O(h) for begin, O(1) for end
+     * Space Complexity: O(h), heap-allocated only past depth 32
+     */
+    iterator begin() const {
+        return iterator::first(root);
+    }
+    
+    iterator end() const {
+        return iterator::last(root);
+    }
+    
+    /**
+     * Iterator to the first key >= value / > value, or end()
+     * Time Complexity: O(h)
+     * Space Complexity: O(h)
+     */
+    iterator lower_bound(const T& value) const {
+        return iterator::lowerBound(root, value);
+    }
+    
+    iterator upper_bound(const T& value) const {
+        return iterator::upperBound(root, value);
+    }
+    
+    /**
+     * Lazy view of the keys in [low, high] in sorted order: nothing is
+     * copied, and stopping early leaves the rest of the range untouched
+     * Time Complexity: O(h) to create, O(1) amortized per key
+     * Space Complexity: O(h) per iterator, heap-allocated only past depth 32
+     */
+    TreeRange<iterator> range(const T& low, const T& high) const {
+        if (high < low) {
+            return TreeRange<iterator>(end(), end());
+        }
+        return TreeRange<iterator>(lower_bound(low), upper_bound(high));
+    }
+    
     /**
      * Print tree structure (for debugging)
      * Time Complexity: O(n)
@@ -505,7 +694,7 @@ private:
 public:
     /**
      * Get k-th smallest element (1-indexed)
-     * Time Complexity: O(h + k)
+     * Time Complexity: O(h) with order statistics, O(h + k) otherwise
      * Space Complexity: O(h)
      */
     T kthSmallest(int k) const {
@@ -513,8 +702,51 @@ public:
             throw std::out_of_range("k is out of range");
         }
         
-        int count = 0;
-        return kthSmallest(root, k, count);
+        if constexpr (OrderStatistics) {
+            return selectNode(root, static_cast<size_t>(k - 1))->data;
+        } else {
+            int count = 0;
+            return kthSmallest(root, k, count);
+        }
+    }
+    
+    /**
+     * Key with exactly index smaller keys (0-indexed)
+     * Requires OrderStatistics; throws std::out_of_range past the end.
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    T select(size_t index) const {
+        static_assert(OrderStatistics, "select requires OrderStatistics = true");
+        if (index >= nodeCount) {
+            throw std::out_of_range("Index is out of range");
+        }
+        return selectNode(root, index)->data;
+    }
+    
+    /**
+     * Number of keys smaller than key (key need not be present)
+     * Requires OrderStatistics.
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    size_t rank(const T& key) const {
+        static_assert(OrderStatistics, "rank requires OrderStatistics = true");
+        return countBelow(root, key, false);
+    }
+    
+    /**
+     * Number of keys in [low, high], without materializing them
+     * Requires OrderStatistics.
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    size_t countInRange(const T& low, const T& high) const {
+        static_assert(OrderStatistics, "countInRange requires OrderStatistics = true");
+        if (high < low) {
+            return 0;
+        }
+        return countBelow(root, high, true) - countBelow(root, low, false);
     }
     
 private:
@@ -577,6 +809,12 @@ private:
     }
 };
 
+/**
+ * Binary search tree with subtree sizes (O(h) select/kthSmallest/rank/countInRange)
+ */
+template<typename T, typename NodeAllocator = SlabArena<TreeNode<T>>>
+using OrderStatisticBST = BinarySearchTree<T, NodeAllocator, true>;
+
 // Example usage and testing
 void demonstrateBST() {
     std::cout << "=== Binary Search Tree Demonstration ===" << std::endl;
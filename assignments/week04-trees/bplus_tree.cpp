@@ -0,0 +1,746 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * B+ Tree Implementation
+ * An AVLNode holds one key and two pointers, so each level of a search is
+ * another cache miss. A B+ tree packs many keys into each node of about
+ * NodeBytes bytes (a few cache lines):
+ *   - inner nodes hold only separator keys and child pointers; a search
+ *     compares against a whole node at once (4 int keys per SSE2 compare,
+ *     binary search for other key types),
+ *   - every key lives in a leaf and leaves are linked in key order, so
+ *     rangeQuery and inorderTraversal scan contiguous arrays,
+ *   - all leaves sit at the same depth, which is O(log_B n) for fanout B.
+ *
+ * Same API as AVLTree<T> (insert, remove, contains, findMin, findMax,
+ * rangeQuery, inorderTraversal, ...). Duplicate values are ignored.
+ */
+
+template<typename T, size_t NodeBytes = 256>
+class BPlusTree {
+    static_assert(NodeBytes >= 64, "NodeBytes must cover at least one cache line");
+
+private:
+    struct Node {
+        bool isLeaf;
+        int count;  // keys in use
+    };
+    
+    static constexpr int fit(size_t bytes, size_t perKey) {
+        return bytes > sizeof(Node) + perKey * 4 ? static_cast<int>((bytes - sizeof(Node)) / perKey) : 4;
+    }
+    
+    // Sized so that a node, header and pointers included, fills NodeBytes
+    static constexpr int LEAF_CAPACITY = fit(NodeBytes - 2 * sizeof(void*), sizeof(T));
+    static constexpr int INNER_CAPACITY = fit(NodeBytes - sizeof(void*), sizeof(T) + sizeof(void*));
+    static constexpr int MIN_LEAF_KEYS = LEAF_CAPACITY / 2;
+    static constexpr int MIN_INNER_KEYS = INNER_CAPACITY / 2;
+    
+    // Every inner node but the root has at least 3 children
+    static constexpr int MAX_DEPTH = 64;
+    
+    struct alignas(64) Leaf : Node {
+        T keys[LEAF_CAPACITY];
+        Leaf* prev;
+        Leaf* next;
+        
+        Leaf() : prev(nullptr), next(nullptr) {
+            this->isLeaf = true;
+            this->count = 0;
+        }
+    };
+    
+    // Child i holds the keys k with keys[i - 1] <= k < keys[i]
+    struct alignas(64) Inner : Node {
+        T keys[INNER_CAPACITY];
+        Node* children[INNER_CAPACITY + 1];
+        
+        Inner() {
+            this->isLeaf = false;
+            this->count = 0;
+        }
+    };
+    
+    Node* root;
+    Leaf* head;   // leftmost leaf
+    Leaf* tail;   // rightmost leaf
+    size_t nodeCount;
+    int treeHeight;
+    
+    /**
+     * Number of keys[0 .. count) that are < value, or <= value when
+     * inclusive is set (keys are sorted)
+     * Time Complexity: O(count / 4) for int keys with SSE2, O(log count) otherwise
+     * Space Complexity: O(1)
+     */
+    static int position(const T* keys, int count, const T& value, bool inclusive) {
+#ifdef __SSE2__
+        if constexpr (std::is_same<T, int>::value) {
+            // A full scan of a few cache lines beats the mispredicted
+            // branches of a binary search
+            const __m128i needle = _mm_set1_epi32(value);
+            __m128i hits = _mm_setzero_si128();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+                // Each lane is -1 where the key is > value (inclusive) or < value
+                hits = _mm_sub_epi32(hits, inclusive ? _mm_cmpgt_epi32(block, needle)
+                                                     : _mm_cmpgt_epi32(needle, block));
+            }
+            hits = _mm_add_epi32(hits, _mm_shuffle_epi32(hits, _MM_SHUFFLE(1, 0, 3, 2)));
+            hits = _mm_add_epi32(hits, _mm_shuffle_epi32(hits, _MM_SHUFFLE(2, 3, 0, 1)));
+            int matched = _mm_cvtsi128_si32(hits);
+            int result = inclusive ? i - matched : matched;
+            for (; i < count; i++) {
+                result += inclusive ? !(value < keys[i]) : keys[i] < value;
+            }
+            return result;
+        }
+#endif
+        const T* found = inclusive ? std::upper_bound(keys, keys + count, value)
+                                   : std::lower_bound(keys, keys + count, value);
+        return static_cast<int>(found - keys);
+    }
+    
+    /**
+     * Descend to the leaf whose key range covers value
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    Leaf* findLeaf(const T& value) const {
+        Node* node = root;
+        while (!node->isLeaf) {
+            Inner* inner = static_cast<Inner*>(node);
+            node = inner->children[position(inner->keys, inner->count, value, true)];
+        }
+        return static_cast<Leaf*>(node);
+    }
+    
+    /**
+     * Split a full leaf around the new key at pos; returns the new right
+     * sibling (already linked into the leaf list)
+     * Time Complexity: O(B)
+     * Space Complexity: O(1)
+     */
+    Leaf* splitLeaf(Leaf* leaf, int pos, const T& value) {
+        const int leftCount = (LEAF_CAPACITY + 1) / 2;
+        Leaf* right = new Leaf();
+        if (pos < leftCount) {
+            std::move(leaf->keys + leftCount - 1, leaf->keys + LEAF_CAPACITY, right->keys);
+            right->count = LEAF_CAPACITY - leftCount + 1;
+            leaf->count = leftCount - 1;
+            insertKey(leaf, pos, value);
+        } else {
+            std::move(leaf->keys + leftCount, leaf->keys + LEAF_CAPACITY, right->keys);
+            right->count = LEAF_CAPACITY - leftCount;
+            leaf->count = leftCount;
+            insertKey(right, pos - leftCount, value);
+        }
+        
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr) {
+            leaf->next->prev = right;
+        } else {
+            tail = right;
+        }
+        leaf->next = right;
+        return right;
+    }
+    
+    static void insertKey(Leaf* leaf, int pos, const T& value) {
+        std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        leaf->keys[pos] = value;
+        leaf->count++;
+    }
+    
+    /**
+     * Split a full inner node that must also take separator / child at
+     * slot. On return the node keeps the lower half, separator holds the
+     * key pushed up to the parent and child the new right half.
+     * Time Complexity: O(B)
+     * Space Complexity: O(B)
+     */
+    void splitInner(Inner* node, int slot, T& separator, Node*& child) {
+        T keys[INNER_CAPACITY + 1];
+        Node* children[INNER_CAPACITY + 2];
+        for (int i = 0, j = 0; i <= INNER_CAPACITY; i++) {
+            keys[i] = i == slot ? std::move(separator) : std::move(node->keys[j++]);
+        }
+        for (int i = 0, j = 0; i <= INNER_CAPACITY + 1; i++) {
+            children[i] = i == slot + 1 ? child : node->children[j++];
+        }
+        
+        const int middle = (INNER_CAPACITY + 1) / 2;
+        Inner* right = new Inner();
+        node->count = middle;
+        right->count = INNER_CAPACITY - middle;
+        std::move(keys, keys + middle, node->keys);
+        std::copy(children, children + middle + 1, node->children);
+        std::move(keys + middle + 1, keys + INNER_CAPACITY + 1, right->keys);
+        std::copy(children + middle + 1, children + INNER_CAPACITY + 2, right->children);
+        
+        separator = std::move(keys[middle]);
+        child = right;
+    }
+    
+    /**
+     * Drop keys[index] and children[index + 1] from an inner node
+     * Time Complexity: O(B)
+     * Space Complexity: O(1)
+     */
+    static void eraseFromInner(Inner* node, int index) {
+        std::move(node->keys + index + 1, node->keys + node->count, node->keys + index);
+        std::copy(node->children + index + 2, node->children + node->count + 1, node->children + index + 1);
+        node->count--;
+    }
+    
+    void unlinkLeaf(Leaf* leaf) {
+        if (leaf->prev != nullptr) {
+            leaf->prev->next = leaf->next;
+        } else {
+            head = leaf->next;
+        }
+        if (leaf->next != nullptr) {
+            leaf->next->prev = leaf->prev;
+        } else {
+            tail = leaf->prev;
+        }
+    }
+    
+    /**
+     * Refill an underfull leaf (child slot of parent) by borrowing one key
+     * from a sibling, or merge it with a sibling; returns true if parent
+     * lost a key
+     * Time Complexity: O(B)
+     * Space Complexity: O(1)
+     */
+    bool fixLeaf(Inner* parent, int slot) {
+        Leaf* leaf = static_cast<Leaf*>(parent->children[slot]);
+        Leaf* left = slot > 0 ? static_cast<Leaf*>(parent->children[slot - 1]) : nullptr;
+        Leaf* right = slot < parent->count ? static_cast<Leaf*>(parent->children[slot + 1]) : nullptr;
+        
+        if (left != nullptr && left->count > MIN_LEAF_KEYS) {
+            insertKey(leaf, 0, std::move(left->keys[--left->count]));
+            parent->keys[slot - 1] = leaf->keys[0];
+            return false;
+        }
+        if (right != nullptr && right->count > MIN_LEAF_KEYS) {
+            leaf->keys[leaf->count++] = std::move(right->keys[0]);
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            right->count--;
+            parent->keys[slot] = right->keys[0];
+            return false;
+        }
+        
+        // Merge into the left one of the pair
+        if (left == nullptr) {
+            left = leaf;
+            leaf = right;
+            slot++;
+        }
+        std::move(leaf->keys, leaf->keys + leaf->count, left->keys + left->count);
+        left->count += leaf->count;
+        unlinkLeaf(leaf);
+        delete leaf;
+        eraseFromInner(parent, slot - 1);
+        return true;
+    }
+    
+    /**
+     * Same as fixLeaf for an underfull inner node: keys rotate through
+     * the parent's separator
+     * Time Complexity: O(B)
+     * Space Complexity: O(1)
+     */
+    bool fixInner(Inner* parent, int slot) {
+        Inner* node = static_cast<Inner*>(parent->children[slot]);
+        Inner* left = slot > 0 ? static_cast<Inner*>(parent->children[slot - 1]) : nullptr;
+        Inner* right = slot < parent->count ? static_cast<Inner*>(parent->children[slot + 1]) : nullptr;
+        
+        if (left != nullptr && left->count > MIN_INNER_KEYS) {
+            std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+            std::copy_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+            node->keys[0] = std::move(parent->keys[slot - 1]);
+            node->children[0] = left->children[left->count];
+            parent->keys[slot - 1] = std::move(left->keys[left->count - 1]);
+            left->count--;
+            node->count++;
+            return false;
+        }
+        if (right != nullptr && right->count > MIN_INNER_KEYS) {
+            node->keys[node->count] = std::move(parent->keys[slot]);
+            node->children[node->count + 1] = right->children[0];
+            node->count++;
+            parent->keys[slot] = std::move(right->keys[0]);
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            std::copy(right->children + 1, right->children + right->count + 1, right->children);
+            right->count--;
+            return false;
+        }
+        
+        if (left == nullptr) {
+            left = node;
+            node = right;
+            slot++;
+        }
+        left->keys[left->count] = std::move(parent->keys[slot - 1]);
+        std::move(node->keys, node->keys + node->count, left->keys + left->count + 1);
+        std::copy(node->children, node->children + node->count + 1, left->children + left->count + 1);
+        left->count += 1 + node->count;
+        delete node;
+        eraseFromInner(parent, slot - 1);
+        return true;
+    }
+    
+    /**
+     * Destroy a subtree
+     * Time Complexity: O(n / B)
+     * Space Complexity: O(log n) recursion
+     */
+    void destroy(Node* node) {
+        if (node->isLeaf) {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for (int i = 0; i <= inner->count; i++) {
+            destroy(inner->children[i]);
+        }
+        delete inner;
+    }
+    
+    /**
+     * Copy a subtree; leaves are visited left to right and relinked as
+     * they are created
+     * Time Complexity: O(n / B)
+     * Space Complexity: O(log n) recursion
+     */
+    Node* clone(const Node* node) {
+        if (node->isLeaf) {
+            const Leaf* source = static_cast<const Leaf*>(node);
+            Leaf* copy = new Leaf();
+            std::copy(source->keys, source->keys + source->count, copy->keys);
+            copy->count = source->count;
+            copy->prev = tail;
+            if (tail != nullptr) {
+                tail->next = copy;
+            } else {
+                head = copy;
+            }
+            tail = copy;
+            return copy;
+        }
+        const Inner* source = static_cast<const Inner*>(node);
+        Inner* copy = new Inner();
+        std::copy(source->keys, source->keys + source->count, copy->keys);
+        copy->count = source->count;
+        for (int i = 0; i <= source->count; i++) {
+            copy->children[i] = clone(source->children[i]);
+        }
+        return copy;
+    }
+    
+    /**
+     * Check sorted order, separator bounds, occupancy and leaf depth of a
+     * subtree whose keys must lie in [low, high) (null bounds are open)
+     */
+    bool isValid(const Node* node, const T* low, const T* high, int depth, bool isRoot,
+                 std::vector<const Leaf*>& leaves) const {
+        int minimum = node->isLeaf ? MIN_LEAF_KEYS : MIN_INNER_KEYS;
+        if (node->count > (node->isLeaf ? LEAF_CAPACITY : INNER_CAPACITY) ||
+            node->count < (isRoot ? 1 : minimum)) {
+            return false;
+        }
+        const T* keys = node->isLeaf ? static_cast<const Leaf*>(node)->keys : static_cast<const Inner*>(node)->keys;
+        for (int i = 0; i < node->count; i++) {
+            if ((i > 0 && !(keys[i - 1] < keys[i])) ||
+                (low != nullptr && keys[i] < *low) || (high != nullptr && !(keys[i] < *high))) {
+                return false;
+            }
+        }
+        if (node->isLeaf) {
+            leaves.push_back(static_cast<const Leaf*>(node));
+            return depth == treeHeight;
+        }
+        const Inner* inner = static_cast<const Inner*>(node);
+        for (int i = 0; i <= inner->count; i++) {
+            const T* childLow = i > 0 ? &inner->keys[i - 1] : low;
+            const T* childHigh = i < inner->count ? &inner->keys[i] : high;
+            if (!isValid(inner->children[i], childLow, childHigh, depth + 1, false, leaves)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Default constructor
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    BPlusTree() : root(nullptr), head(nullptr), tail(nullptr), nodeCount(0), treeHeight(-1) {}
+    
+    /**
+     * Copy constructor
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    BPlusTree(const BPlusTree& other) : BPlusTree() {
+        if (other.root != nullptr) {
+            root = clone(other.root);
+            nodeCount = other.nodeCount;
+            treeHeight = other.treeHeight;
+        }
+    }
+    
+    /**
+     * Assignment operator
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    BPlusTree& operator=(const BPlusTree& other) {
+        if (this != &other) {
+            BPlusTree copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    
+    /**
+     * Move constructor
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    BPlusTree(BPlusTree&& other) noexcept : BPlusTree() {
+        swap(other);
+    }
+    
+    /**
+     * Move assignment operator
+     * Time Complexity: O(n / B) to free the old nodes
+     * Space Complexity: O(1)
+     */
+    BPlusTree& operator=(BPlusTree&& other) noexcept {
+        if (this != &other) {
+            makeEmpty();
+            swap(other);
+        }
+        return *this;
+    }
+    
+    /**
+     * Destructor
+     * Time Complexity: O(n / B)
+     * Space Complexity: O(log n)
+     */
+    ~BPlusTree() {
+        makeEmpty();
+    }
+    
+    void swap(BPlusTree& other) noexcept {
+        std::swap(root, other.root);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(nodeCount, other.nodeCount);
+        std::swap(treeHeight, other.treeHeight);
+    }
+    
+    /**
+     * Insert a value into the tree
+     * A full leaf splits in two and pushes its right half's first key up;
+     * splits cascade while parents are full, and a root split adds a level.
+     * Time Complexity: O(B log_B n)
+     * Space Complexity: O(1) (fixed-size path array)
+     */
+    void insert(const T& value) {
+        if (root == nullptr) {
+            Leaf* leaf = new Leaf();
+            leaf->keys[0] = value;
+            leaf->count = 1;
+            root = head = tail = leaf;
+            nodeCount = 1;
+            treeHeight = 0;
+            return;
+        }
+        
+        Inner* path[MAX_DEPTH];
+        int slots[MAX_DEPTH];
+        int depth = 0;
+        Node* node = root;
+        while (!node->isLeaf) {
+            Inner* inner = static_cast<Inner*>(node);
+            int slot = position(inner->keys, inner->count, value, true);
+            path[depth] = inner;
+            slots[depth++] = slot;
+            node = inner->children[slot];
+        }
+        
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = position(leaf->keys, leaf->count, value, false);
+        if (pos < leaf->count && !(value < leaf->keys[pos])) {
+            return; // Duplicate values are not allowed
+        }
+        nodeCount++;
+        if (leaf->count < LEAF_CAPACITY) {
+            insertKey(leaf, pos, value);
+            return;
+        }
+        
+        Leaf* right = splitLeaf(leaf, pos, value);
+        T separator = right->keys[0];
+        Node* child = right;
+        while (depth > 0) {
+            Inner* parent = path[--depth];
+            int slot = slots[depth];
+            if (parent->count < INNER_CAPACITY) {
+                std::move_backward(parent->keys + slot, parent->keys + parent->count,
+                                   parent->keys + parent->count + 1);
+                std::copy_backward(parent->children + slot + 1, parent->children + parent->count + 1,
+                                   parent->children + parent->count + 2);
+                parent->keys[slot] = std::move(separator);
+                parent->children[slot + 1] = child;
+                parent->count++;
+                return;
+            }
+            splitInner(parent, slot, separator, child);
+        }
+        
+        Inner* newRoot = new Inner();
+        newRoot->keys[0] = std::move(separator);
+        newRoot->children[0] = root;
+        newRoot->children[1] = child;
+        newRoot->count = 1;
+        root = newRoot;
+        treeHeight++;
+    }
+    
+    /**
+     * Remove a value from the tree
+     * An underfull node borrows a key from a sibling or merges with it;
+     * merges cascade upwards and an empty root gives up a level.
+     * Time Complexity: O(B log_B n)
+     * Space Complexity: O(1) (fixed-size path array)
+     */
+    void remove(const T& value) {
+        if (root == nullptr) {
+            return;
+        }
+        
+        Inner* path[MAX_DEPTH];
+        int slots[MAX_DEPTH];
+        int depth = 0;
+        Node* node = root;
+        while (!node->isLeaf) {
+            Inner* inner = static_cast<Inner*>(node);
+            int slot = position(inner->keys, inner->count, value, true);
+            path[depth] = inner;
+            slots[depth++] = slot;
+            node = inner->children[slot];
+        }
+        
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int pos = position(leaf->keys, leaf->count, value, false);
+        if (pos == leaf->count || value < leaf->keys[pos]) {
+            return;
+        }
+        std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+        leaf->count--;
+        nodeCount--;
+        
+        if (depth == 0) {
+            if (leaf->count == 0) {
+                delete leaf;
+                root = head = tail = nullptr;
+                treeHeight = -1;
+            }
+            return;
+        }
+        if (leaf->count >= MIN_LEAF_KEYS || !fixLeaf(path[depth - 1], slots[depth - 1])) {
+            return;
+        }
+        
+        // The parent lost a key; repair inner nodes up to the root
+        depth--;
+        while (depth > 0 && path[depth]->count < MIN_INNER_KEYS) {
+            depth--;
+            if (!fixInner(path[depth], slots[depth])) {
+                return;
+            }
+        }
+        if (root->count == 0) {
+            Inner* oldRoot = static_cast<Inner*>(root);
+            root = oldRoot->children[0];
+            delete oldRoot;
+            treeHeight--;
+        }
+    }
+    
+    /**
+     * Check if value exists in tree
+     * Time Complexity: O(B log_B n) comparisons, O(log_B n) cache misses
+     * Space Complexity: O(1)
+     */
+    bool contains(const T& value) const {
+        if (root == nullptr) {
+            return false;
+        }
+        Leaf* leaf = findLeaf(value);
+        int pos = position(leaf->keys, leaf->count, value, false);
+        return pos < leaf->count && !(value < leaf->keys[pos]);
+    }
+    
+    /**
+     * Find minimum value in tree
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T findMin() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        return head->keys[0];
+    }
+    
+    /**
+     * Find maximum value in tree
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    T findMax() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        return tail->keys[tail->count - 1];
+    }
+    
+    /**
+     * Check if tree is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return root == nullptr;
+    }
+    
+    /**
+     * Get number of keys in tree
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    size_t size() const {
+        return nodeCount;
+    }
+    
+    /**
+     * Get height of tree (edges from the root to the leaves, -1 if empty)
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getHeight() const {
+        return treeHeight;
+    }
+    
+    /**
+     * Remove all keys from tree
+     * Time Complexity: O(n / B)
+     * Space Complexity: O(log n)
+     */
+    void makeEmpty() {
+        if (root != nullptr) {
+            destroy(root);
+        }
+        root = nullptr;
+        head = tail = nullptr;
+        nodeCount = 0;
+        treeHeight = -1;
+    }
+    
+    /**
+     * Inorder traversal (sorted order), read straight off the leaf list
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    std::vector<T> inorderTraversal() const {
+        std::vector<T> result;
+        result.reserve(nodeCount);
+        for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+            result.insert(result.end(), leaf->keys, leaf->keys + leaf->count);
+        }
+        return result;
+    }
+    
+    /**
+     * Range query: find all values in [low, high]
+     * One descent to the first key >= low, then a scan along the leaves
+     * Time Complexity: O(log n + k) where k is number of results
+     * Space Complexity: O(k)
+     */
+    std::vector<T> rangeQuery(const T& low, const T& high) const {
+        std::vector<T> result;
+        if (root == nullptr || high < low) {
+            return result;
+        }
+        const Leaf* leaf = findLeaf(low);
+        int pos = position(leaf->keys, leaf->count, low, false);
+        while (leaf != nullptr) {
+            for (; pos < leaf->count; pos++) {
+                if (high < leaf->keys[pos]) {
+                    return result;
+                }
+                result.push_back(leaf->keys[pos]);
+            }
+            leaf = leaf->next;
+            pos = 0;
+        }
+        return result;
+    }
+    
+    /**
+     * Check every B+ tree invariant (for testing): sorted keys within
+     * their separators, node occupancy, equal leaf depth, and a leaf list
+     * that matches the tree
+     * Time Complexity: O(n)
+     * Space Complexity: O(n / B)
+     */
+    bool isValid() const {
+        if (root == nullptr) {
+            return head == nullptr && tail == nullptr && nodeCount == 0 && treeHeight == -1;
+        }
+        std::vector<const Leaf*> leaves;
+        if (!isValid(root, nullptr, nullptr, 0, true, leaves)) {
+            return false;
+        }
+        size_t keys = 0;
+        const Leaf* expected = head;
+        for (size_t i = 0; i < leaves.size(); i++) {
+            if (leaves[i] != expected || leaves[i]->prev != (i > 0 ? leaves[i - 1] : nullptr)) {
+                return false;
+            }
+            keys += leaves[i]->count;
+            expected = expected->next;
+        }
+        return expected == nullptr && tail == leaves.back() && keys == nodeCount;
+    }
+    
+    /**
+     * Keys per leaf and per inner node for this key type and NodeBytes
+     */
+    static constexpr int leafCapacity() {
+        return LEAF_CAPACITY;
+    }
+    
+    static constexpr int innerCapacity() {
+        return INNER_CAPACITY;
+    }
+};
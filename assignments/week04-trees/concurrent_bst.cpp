@@ -0,0 +1,492 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/**
+ * Concurrent Binary Search Tree (optimistic fine-grained locking)
+ * An ordered set for many threads at once, without a global lock.
+ * Keys live in the leaves; internal nodes only route (an external BST),
+ * so an update only changes one child pointer:
+ *   - contains walks down without locking or writing anything,
+ *   - insert locks only the parent of the leaf it replaces,
+ *   - remove locks the grandparent and the parent and splices the
+ *     leaf's sibling into the grandparent,
+ * and each writer re-checks after locking that the nodes it found are
+ * still linked, retrying from the root otherwise.
+ *
+ * Every internal node carries a version word that is also its lock (odd
+ * while held, bumped on every change). rangeQuery collects keys without
+ * locking, recording the version of each node it reads, and succeeds if
+ * none changed: all its reads then held at one instant, so the result is
+ * a linearizable snapshot. After repeated conflicts it locks its part of
+ * the tree top-down instead.
+ *
+ * Unlinked nodes are freed once no operation that could still see them
+ * is running (epoch-based reclamation with per-thread-group counters).
+ * The tree is not rebalanced: depth is O(log n) expected for keys in
+ * random order, O(n) for sorted insertions.
+ */
+
+template<typename T>
+class ConcurrentBST {
+private:
+    struct Node {
+        T key;
+        bool isLeaf;
+        bool isInfinite;                  // sentinel key, greater than every T
+        std::atomic<Node*> left;
+        std::atomic<Node*> right;
+        std::atomic<uint64_t> version;    // odd while locked
+        std::atomic<bool> removed;        // unlinked from the tree
+        
+        Node(const T& value, bool leaf, bool infinite, Node* l, Node* r)
+            : key(value), isLeaf(leaf), isInfinite(infinite), left(l), right(r), version(0), removed(false) {}
+    };
+    
+    static constexpr int STRIPES = 64;
+    static constexpr int OPTIMISTIC_ATTEMPTS = 8;
+    static constexpr int RECLAIM_THRESHOLD = 256;
+    static constexpr int SPINS_BEFORE_YIELD = 64;
+    
+    // Threads are spread over stripes so that entering an operation and
+    // counting keys touch mostly thread-private cache lines
+    struct alignas(64) Stripe {
+        std::atomic<long> active[2];      // operations running, by epoch parity
+        std::atomic<long> count;          // inserts minus removes
+        std::atomic<int> pending;         // retired since the last reclaim
+        std::mutex retireLock;
+        std::vector<std::pair<uint64_t, Node*>> retired;
+        
+        Stripe() : active{{0}, {0}}, count(0), pending(0) {}
+    };
+    
+    Node* root;
+    mutable Stripe stripes[STRIPES];
+    mutable std::atomic<uint64_t> epoch;
+    mutable std::mutex reclaimLock;
+    mutable std::mutex fallbackLock;
+    
+    static int stripeIndex() {
+        static std::atomic<int> nextThread(0);
+        thread_local int index = nextThread.fetch_add(1, std::memory_order_relaxed) % STRIPES;
+        return index;
+    }
+    
+    /**
+     * Registers the calling thread as running an operation for as long as
+     * it lives; nodes retired meanwhile are not freed
+     */
+    class EpochGuard {
+    private:
+        Stripe& stripe;
+        uint64_t entered;
+    
+    public:
+        explicit EpochGuard(const ConcurrentBST& tree) : stripe(tree.stripes[stripeIndex()]) {
+            while (true) {
+                entered = tree.epoch.load();
+                stripe.active[entered & 1].fetch_add(1);
+                if (tree.epoch.load() == entered) {
+                    return;
+                }
+                stripe.active[entered & 1].fetch_sub(1);
+            }
+        }
+        
+        ~EpochGuard() {
+            stripe.active[entered & 1].fetch_sub(1);
+        }
+    };
+    
+    static bool goesLeft(const T& key, const Node* node) {
+        return node->isInfinite || key < node->key;
+    }
+    
+    static bool matches(const Node* leaf, const T& key) {
+        return !leaf->isInfinite && !(key < leaf->key) && !(leaf->key < key);
+    }
+    
+    static std::atomic<Node*>& childLink(Node* node, const T& key) {
+        return goesLeft(key, node) ? node->left : node->right;
+    }
+    
+    static void lock(Node* node) {
+        int spins = 0;
+        while (true) {
+            uint64_t version = node->version.load(std::memory_order_relaxed);
+            if ((version & 1) == 0 &&
+                node->version.compare_exchange_weak(version, version + 1, std::memory_order_acq_rel)) {
+                return;
+            }
+            if (++spins >= SPINS_BEFORE_YIELD) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    
+    static void unlock(Node* node) {
+        node->version.fetch_add(1, std::memory_order_release);
+    }
+    
+    struct Position {
+        Node* grandparent;
+        Node* parent;
+        Node* leaf;
+    };
+    
+    /**
+     * Walk down to the leaf where key is or would be
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    Position find(const T& key) const {
+        Node* grandparent = nullptr;
+        Node* parent = root;
+        Node* node = root->left.load(std::memory_order_acquire);
+        while (!node->isLeaf) {
+            grandparent = parent;
+            parent = node;
+            node = childLink(node, key).load(std::memory_order_acquire);
+        }
+        return {grandparent, parent, node};
+    }
+    
+    /**
+     * Hand an unlinked node to the reclaimer
+     */
+    void retire(Node* node) {
+        Stripe& stripe = stripes[stripeIndex()];
+        std::lock_guard<std::mutex> guard(stripe.retireLock);
+        stripe.retired.push_back({epoch.load(), node});
+        stripe.pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    /**
+     * Advance the epoch if every operation of the epoch before the current
+     * one has finished, and free the nodes no running operation can reach
+     * Time Complexity: O(STRIPES + retired nodes)
+     * Space Complexity: O(1)
+     */
+    void tryReclaim() {
+        std::unique_lock<std::mutex> guard(reclaimLock, std::try_to_lock);
+        if (!guard.owns_lock()) {
+            return;
+        }
+        uint64_t current = epoch.load();
+        for (Stripe& stripe : stripes) {
+            if (stripe.active[(current + 1) & 1].load() != 0) {
+                return;
+            }
+        }
+        epoch.store(current + 1);
+        
+        // Operations that started before current are done; nodes retired
+        // before it were unlinked before any running operation began
+        for (Stripe& stripe : stripes) {
+            std::lock_guard<std::mutex> retireGuard(stripe.retireLock);
+            auto kept = std::partition(stripe.retired.begin(), stripe.retired.end(),
+                                       [current](const std::pair<uint64_t, Node*>& entry) {
+                                           return entry.first >= current;
+                                       });
+            for (auto it = kept; it != stripe.retired.end(); ++it) {
+                delete it->second;
+            }
+            stripe.retired.erase(kept, stripe.retired.end());
+            stripe.pending.store(0, std::memory_order_relaxed);
+        }
+    }
+    
+    void maybeReclaim() {
+        if (stripes[stripeIndex()].pending.load(std::memory_order_relaxed) >= RECLAIM_THRESHOLD) {
+            tryReclaim();
+        }
+    }
+    
+    static bool aboveLow(const Node* node, const T* low) {
+        return low == nullptr || node->isInfinite || *low < node->key;
+    }
+    
+    static bool belowHigh(const Node* node, const T* high) {
+        return !node->isInfinite && (high == nullptr || !(*high < node->key));
+    }
+    
+    static bool inRange(const Node* leaf, const T* low, const T* high) {
+        return !leaf->isInfinite && (low == nullptr || !(leaf->key < *low)) &&
+               (high == nullptr || !(*high < leaf->key));
+    }
+    
+    /**
+     * One optimistic pass over the nodes whose subtrees meet [low, high]
+     * (null bounds are open). Returns false if a writer got in the way.
+     * Time Complexity: O(h + k) expected
+     * Space Complexity: O(h + k)
+     */
+    bool collectOptimistic(const T* low, const T* high, std::vector<T>& result) const {
+        std::vector<std::pair<Node*, uint64_t>> readSet;
+        std::vector<Node*> stack = {root};
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            if (node->isLeaf) {
+                if (inRange(node, low, high)) {
+                    result.push_back(node->key);
+                }
+                continue;
+            }
+            uint64_t version = node->version.load(std::memory_order_acquire);
+            if (version & 1) {
+                return false;
+            }
+            Node* left = node->left.load(std::memory_order_acquire);
+            Node* right = node->right.load(std::memory_order_acquire);
+            readSet.push_back({node, version});
+            // Right is pushed first so that leaves come out in key order
+            if (belowHigh(node, high)) {
+                stack.push_back(right);
+            }
+            if (aboveLow(node, low)) {
+                stack.push_back(left);
+            }
+        }
+        for (const auto& entry : readSet) {
+            if (entry.first->version.load(std::memory_order_acquire) != entry.second) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    /**
+     * Pessimistic pass: lock each node before reading its children and
+     * hold every lock until the end. A locked node cannot be unlinked (its
+     * parent is locked too), so the locked part of the tree is frozen.
+     * Locks are taken parent before child, the same order as writers.
+     * Time Complexity: O(h + k) expected
+     * Space Complexity: O(h + k)
+     */
+    void collectLocked(const T* low, const T* high, std::vector<T>& result) const {
+        std::vector<Node*> locked;
+        std::vector<Node*> stack = {root};
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            if (node->isLeaf) {
+                if (inRange(node, low, high)) {
+                    result.push_back(node->key);
+                }
+                continue;
+            }
+            lock(node);
+            locked.push_back(node);
+            if (belowHigh(node, high)) {
+                stack.push_back(node->right.load(std::memory_order_acquire));
+            }
+            if (aboveLow(node, low)) {
+                stack.push_back(node->left.load(std::memory_order_acquire));
+            }
+        }
+        for (Node* node : locked) {
+            unlock(node);
+        }
+    }
+    
+    std::vector<T> collect(const T* low, const T* high) const {
+        EpochGuard guard(*this);
+        std::vector<T> result;
+        for (int attempt = 0; attempt < OPTIMISTIC_ATTEMPTS; attempt++) {
+            if (collectOptimistic(low, high, result)) {
+                return result;
+            }
+            result.clear();
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> fallback(fallbackLock);
+        collectLocked(low, high, result);
+        return result;
+    }
+
+public:
+    /**
+     * Constructor - sentinel routers over two infinite leaves, so every
+     * real leaf has a parent and a grandparent
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    ConcurrentBST() : epoch(1) {
+        Node* inner = new Node(T(), false, true, new Node(T(), true, true, nullptr, nullptr),
+                               new Node(T(), true, true, nullptr, nullptr));
+        root = new Node(T(), false, true, inner, new Node(T(), true, true, nullptr, nullptr));
+    }
+    
+    ConcurrentBST(const ConcurrentBST&) = delete;
+    ConcurrentBST& operator=(const ConcurrentBST&) = delete;
+    
+    /**
+     * Destructor - no other thread may be using the tree
+     * Time Complexity: O(n + retired nodes)
+     * Space Complexity: O(h)
+     */
+    ~ConcurrentBST() {
+        std::vector<Node*> stack = {root};
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            if (!node->isLeaf) {
+                stack.push_back(node->left.load(std::memory_order_relaxed));
+                stack.push_back(node->right.load(std::memory_order_relaxed));
+            }
+            delete node;
+        }
+        for (Stripe& stripe : stripes) {
+            for (const auto& entry : stripe.retired) {
+                delete entry.second;
+            }
+        }
+    }
+    
+    /**
+     * Insert key; returns false if it was already present
+     * Time Complexity: O(h) expected, plus retries under contention
+     * Space Complexity: O(1)
+     */
+    bool insert(const T& key) {
+        Node* leafNode = nullptr;
+        {
+            EpochGuard guard(*this);
+            while (true) {
+                Position position = find(key);
+                if (matches(position.leaf, key)) {
+                    delete leafNode;
+                    return false;
+                }
+                if (leafNode == nullptr) {
+                    leafNode = new Node(key, true, false, nullptr, nullptr);
+                }
+                
+                Node* parent = position.parent;
+                std::atomic<Node*>& link = childLink(parent, key);
+                lock(parent);
+                if (parent->removed.load(std::memory_order_relaxed) ||
+                    link.load(std::memory_order_relaxed) != position.leaf) {
+                    unlock(parent);
+                    continue;
+                }
+                // The new router takes the larger key, so that key goes right
+                Node* old = position.leaf;
+                Node* router = goesLeft(key, old)
+                    ? new Node(old->key, false, old->isInfinite, leafNode, old)
+                    : new Node(key, false, false, old, leafNode);
+                link.store(router, std::memory_order_release);
+                unlock(parent);
+                break;
+            }
+        }
+        stripes[stripeIndex()].count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    
+    /**
+     * Remove key; returns false if it was not present
+     * Time Complexity: O(h) expected, plus retries under contention
+     * Space Complexity: O(1)
+     */
+    bool remove(const T& key) {
+        {
+            EpochGuard guard(*this);
+            while (true) {
+                Position position = find(key);
+                if (!matches(position.leaf, key)) {
+                    return false;
+                }
+                
+                Node* grandparent = position.grandparent;
+                Node* parent = position.parent;
+                std::atomic<Node*>& upperLink = childLink(grandparent, key);
+                std::atomic<Node*>& lowerLink = childLink(parent, key);
+                lock(grandparent);
+                lock(parent);
+                if (grandparent->removed.load(std::memory_order_relaxed) ||
+                    parent->removed.load(std::memory_order_relaxed) ||
+                    upperLink.load(std::memory_order_relaxed) != parent ||
+                    lowerLink.load(std::memory_order_relaxed) != position.leaf) {
+                    unlock(parent);
+                    unlock(grandparent);
+                    continue;
+                }
+                Node* sibling = (&lowerLink == &parent->left ? parent->right : parent->left)
+                                    .load(std::memory_order_relaxed);
+                upperLink.store(sibling, std::memory_order_release);
+                parent->removed.store(true, std::memory_order_relaxed);
+                unlock(parent);
+                unlock(grandparent);
+                
+                retire(parent);
+                retire(position.leaf);
+                break;
+            }
+        }
+        stripes[stripeIndex()].count.fetch_sub(1, std::memory_order_relaxed);
+        maybeReclaim();
+        return true;
+    }
+    
+    /**
+     * Check if key is present (never locks or writes shared memory
+     * other than the epoch counter of the calling thread's stripe)
+     * Time Complexity: O(h) expected
+     * Space Complexity: O(1)
+     */
+    bool contains(const T& key) const {
+        EpochGuard guard(*this);
+        return matches(find(key).leaf, key);
+    }
+    
+    /**
+     * Linearizable range query: all keys in [low, high] at one instant,
+     * in sorted order
+     * Time Complexity: O(h + k) expected per attempt
+     * Space Complexity: O(h + k)
+     */
+    std::vector<T> rangeQuery(const T& low, const T& high) const {
+        if (high < low) {
+            return {};
+        }
+        return collect(&low, &high);
+    }
+    
+    /**
+     * Linearizable snapshot of every key, in sorted order
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    std::vector<T> inorderTraversal() const {
+        return collect(nullptr, nullptr);
+    }
+    
+    /**
+     * Number of keys; exact when no update is in flight
+     * Time Complexity: O(STRIPES)
+     * Space Complexity: O(1)
+     */
+    size_t size() const {
+        long total = 0;
+        for (const Stripe& stripe : stripes) {
+            total += stripe.count.load(std::memory_order_relaxed);
+        }
+        return total > 0 ? static_cast<size_t>(total) : 0;
+    }
+    
+    /**
+     * Check if tree is empty (same caveat as size)
+     * Time Complexity: O(STRIPES)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return size() == 0;
+    }
+};
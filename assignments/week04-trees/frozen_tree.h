@@ -0,0 +1,373 @@
+#ifndef FROZEN_TREE_H
+#define FROZEN_TREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Frozen (read-only) search tree snapshot
+ * Keys are stored in one contiguous array in Eytzinger (BFS) order: the
+ * node at 1-based index i has children 2i and 2i + 1, so there are no
+ * pointers, and a search descends with i = 2i + (key < x), a branch-free
+ * step. The top levels of the tree share the first cache lines, and the
+ * descendants four levels down are prefetched while the current level is
+ * compared. No query allocates except rangeQuery's result vector.
+ *
+ * A snapshot can be written to disk with save() and mapped back with
+ * load(); the mapped file is used in place (keys must be trivially
+ * copyable, and the file is only portable between machines with the same
+ * key representation).
+ */
+
+template<typename T>
+class FrozenTree {
+private:
+    struct FileHeader {
+        char magic[8];
+        uint64_t keyBytes;
+        uint64_t count;
+        uint64_t reserved;
+    };
+
+    static constexpr char MAGIC[8] = {'E', 'Y', 'T', 'Z', 'T', 'R', 'E', 'E'};
+
+    std::vector<T> owned;   // storage when built in memory
+    const T* keys;          // keys[i - 1] is node i
+    size_t count;
+    void* mapping;          // storage when loaded from a file
+    size_t mappingBytes;
+
+    const T& key(size_t i) const {
+        return keys[i - 1];
+    }
+
+    /**
+     * Next node in sorted order, or 0 after the last one
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1)
+     */
+    size_t successor(size_t i) const {
+        if (2 * i + 1 <= count) {
+            i = 2 * i + 1;
+            while (2 * i <= count) {
+                i = 2 * i;
+            }
+            return i;
+        }
+        // Climb while i is a right child, then once more
+        while (i & 1) {
+            i >>= 1;
+        }
+        return i >> 1;
+    }
+
+    size_t leftmost() const {
+        size_t i = count == 0 ? 0 : 1;
+        while (2 * i <= count && i != 0) {
+            i = 2 * i;
+        }
+        return i;
+    }
+
+    /**
+     * Node holding the first key >= value, or 0 if there is none
+     * Each step goes right exactly when the key is < value; the answer is
+     * the last node where the search went left, recovered from the bits
+     * of the final index.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    size_t lowerBound(const T& value) const {
+        size_t i = 1;
+        while (i <= count) {
+#if defined(__GNUC__)
+            // Node 16i starts the 16 descendants four levels down
+            if (16 * i <= count) {
+                __builtin_prefetch(keys + 16 * i - 1);
+            }
+#endif
+            i = 2 * i + (key(i) < value);
+        }
+        return i >> (__builtin_ctzll(~static_cast<unsigned long long>(i)) + 1);
+    }
+
+    /**
+     * Nodes in the subtree rooted at i, from the shape of a complete tree
+     * Time Complexity: O(log n) arithmetic, no memory access
+     * Space Complexity: O(1)
+     */
+    size_t subtreeSize(size_t i) const {
+        size_t size = 0;
+        for (size_t first = i, last = i; first <= count; first = 2 * first, last = 2 * last + 1) {
+            size += std::min(last, count) - first + 1;
+        }
+        return size;
+    }
+
+    void release() {
+        if (mapping != nullptr) {
+            munmap(mapping, mappingBytes);
+        }
+        owned.clear();
+        keys = nullptr;
+        count = 0;
+        mapping = nullptr;
+        mappingBytes = 0;
+    }
+
+public:
+    /**
+     * Empty snapshot
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    FrozenTree() : keys(nullptr), count(0), mapping(nullptr), mappingBytes(0) {}
+
+    /**
+     * Lay out a strictly increasing sequence in Eytzinger order
+     * Throws std::invalid_argument if the input is not strictly increasing.
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit FrozenTree(const std::vector<T>& sorted) : FrozenTree() {
+        for (size_t k = 1; k < sorted.size(); k++) {
+            if (!(sorted[k - 1] < sorted[k])) {
+                throw std::invalid_argument("Input must be strictly increasing");
+            }
+        }
+        owned.resize(sorted.size());
+        keys = owned.data();
+        count = sorted.size();
+
+        // An in-order walk of the implicit tree visits nodes in key order
+        size_t i = leftmost();
+        for (const T& value : sorted) {
+            owned[i - 1] = value;
+            i = successor(i);
+        }
+    }
+
+    FrozenTree(const FrozenTree&) = delete;
+    FrozenTree& operator=(const FrozenTree&) = delete;
+
+    /**
+     * Move constructor - takes over the array or the mapping
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    FrozenTree(FrozenTree&& other) noexcept : FrozenTree() {
+        *this = std::move(other);
+    }
+
+    FrozenTree& operator=(FrozenTree&& other) noexcept {
+        if (this != &other) {
+            release();
+            owned = std::move(other.owned);
+            keys = other.keys;
+            count = other.count;
+            mapping = other.mapping;
+            mappingBytes = other.mappingBytes;
+            other.keys = nullptr;
+            other.count = 0;
+            other.mapping = nullptr;
+            other.mappingBytes = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor - frees the array or unmaps the file
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    ~FrozenTree() {
+        release();
+    }
+
+    /**
+     * Check if value is in the snapshot
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    bool contains(const T& value) const {
+        size_t i = lowerBound(value);
+        return i != 0 && !(value < key(i));
+    }
+
+    /**
+     * Find minimum / maximum value
+     * Throws std::runtime_error if the snapshot is empty.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T findMin() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        return key(leftmost());
+    }
+
+    T findMax() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        size_t i = 1;
+        while (2 * i + 1 <= count) {
+            i = 2 * i + 1;
+        }
+        return key(i);
+    }
+
+    /**
+     * Get k-th smallest element (1-indexed)
+     * Subtree sizes follow from the array length, so none are stored.
+     * Throws std::out_of_range for k outside [1, n].
+     * Time Complexity: O(log n) memory accesses, O(log^2 n) arithmetic
+     * Space Complexity: O(1)
+     */
+    T kthSmallest(size_t k) const {
+        if (k == 0 || k > count) {
+            throw std::out_of_range("k is out of range");
+        }
+        size_t index = k - 1;
+        size_t i = 1;
+        while (true) {
+            size_t leftSize = subtreeSize(2 * i);
+            if (index < leftSize) {
+                i = 2 * i;
+            } else if (index > leftSize) {
+                index -= leftSize + 1;
+                i = 2 * i + 1;
+            } else {
+                return key(i);
+            }
+        }
+    }
+
+    /**
+     * Call visit(key) for every key in [low, high], in order
+     * Time Complexity: O(log n + k) where k is number of results
+     * Space Complexity: O(1)
+     */
+    template<typename Visitor>
+    void forEachInRange(const T& low, const T& high, Visitor visit) const {
+        for (size_t i = lowerBound(low); i != 0 && !(high < key(i)); i = successor(i)) {
+            visit(key(i));
+        }
+    }
+
+    /**
+     * Range query: find all values in [low, high]
+     * Time Complexity: O(log n + k) where k is number of results
+     * Space Complexity: O(k)
+     */
+    std::vector<T> rangeQuery(const T& low, const T& high) const {
+        std::vector<T> result;
+        forEachInRange(low, high, [&result](const T& value) { result.push_back(value); });
+        return result;
+    }
+
+    /**
+     * Check if snapshot is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    /**
+     * Get number of keys
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * Check if the keys are backed by a mapped file
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isMapped() const {
+        return mapping != nullptr;
+    }
+
+    /**
+     * Write the snapshot to path (header followed by the raw array)
+     * Throws std::runtime_error if the file cannot be written.
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    void save(const std::string& path) const {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable keys can be saved");
+        FileHeader header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.keyBytes = sizeof(T);
+        header.count = count;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(keys), static_cast<std::streamsize>(count * sizeof(T)));
+        if (!out) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }
+
+    /**
+     * Map a file written by save() and query it in place; pages are read
+     * from disk on first touch
+     * Throws std::runtime_error if the file is missing or malformed.
+     * Time Complexity: O(1)
+     * Space Complexity: O(1) (the file is mapped read-only, not copied)
+     */
+    static FrozenTree load(const std::string& path) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable keys can be loaded");
+        static_assert(alignof(T) <= sizeof(FileHeader), "Keys would be misaligned after the header");
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(FileHeader)) {
+            close(fd);
+            throw std::runtime_error("Not a frozen tree file: " + path);
+        }
+        size_t bytes = static_cast<size_t>(info.st_size);
+        void* base = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("Cannot map " + path);
+        }
+
+        const FileHeader* header = static_cast<const FileHeader*>(base);
+        // count comes from the file: bound it before multiplying so it cannot wrap
+        if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->keyBytes != sizeof(T) ||
+            header->count > (bytes - sizeof(FileHeader)) / sizeof(T) ||
+            bytes != sizeof(FileHeader) + header->count * sizeof(T)) {
+            munmap(base, bytes);
+            throw std::runtime_error("Not a frozen tree file: " + path);
+        }
+
+        FrozenTree tree;
+        tree.mapping = base;
+        tree.mappingBytes = bytes;
+        tree.count = header->count;
+        tree.keys = reinterpret_cast<const T*>(static_cast<const char*>(base) + sizeof(FileHeader));
+        return tree;
+    }
+};
+
+#endif
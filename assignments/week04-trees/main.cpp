@@ -2,10 +2,672 @@
 #include <vector>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <thread>
+#include <shared_mutex>
 #include "binary_search_tree.cpp"
 #include "avl_tree.cpp"
+#include "bplus_tree.cpp"
+#include "persistent_avl_tree.cpp"
+#include "concurrent_bst.cpp"
 #include "tree_applications.cpp"
 
+/**
+ * Build, search and teardown times for one tree type over the same keys
+ */
+template<typename Tree>
+std::vector<long long> timeTreeLifecycle(const std::vector<int>& keys) {
+    Tree tree;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        tree.insert(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long buildTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long found = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found += tree.contains(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long searchTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    tree.makeEmpty();
+    end = std::chrono::high_resolution_clock::now();
+    long long teardownTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    return {buildTime, searchTime, teardownTime, found};
+}
+
+void benchmarkNodeAllocation() {
+    const int NUM_KEYS = 1000000;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 41;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+
+    struct Row {
+        const char* name;
+        std::vector<long long> times;
+    };
+    std::vector<Row> rows = {
+        {"BST, new/delete   ", timeTreeLifecycle<BinarySearchTree<int, HeapAllocator<TreeNode<int>>>>(keys)},
+        {"BST, slab arena   ", timeTreeLifecycle<BinarySearchTree<int>>(keys)},
+        {"AVL, new/delete   ", timeTreeLifecycle<AVLTree<int, HeapAllocator<AVLNode<int>>>>(keys)},
+        {"AVL, slab arena   ", timeTreeLifecycle<AVLTree<int>>(keys)},
+    };
+
+    std::cout << NUM_KEYS << " random keys (build / search / teardown, microseconds):" << std::endl;
+    bool agree = true;
+    for (const Row& row : rows) {
+        std::cout << row.name << row.times[0] << " / " << row.times[1] << " / " << row.times[2] << std::endl;
+        agree = agree && row.times[3] == rows[0].times[3];
+    }
+    std::cout << "Search results agree: " << std::boolalpha << agree << std::endl;
+}
+
+void benchmarkIterativeAVL() {
+    const int NUM_KEYS = 1000000;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 42;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+
+    AVLTree<int> iterative;
+    AVLTree<int> recursive;
+    long long times[2][3];
+    long long found[2] = {0, 0};
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        recursive.insertRecursive(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    times[0][0] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        iterative.insert(key);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[1][0] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found[0] += recursive.containsRecursive(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[0][1] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found[1] += iterative.contains(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[1][1] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        recursive.removeRecursive(key);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[0][2] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        iterative.remove(key);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[1][2] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << NUM_KEYS << " random keys (insert / contains / remove, microseconds):" << std::endl;
+    std::cout << "Recursive AVL: " << times[0][0] << " / " << times[0][1] << " / " << times[0][2] << std::endl;
+    std::cout << "Iterative AVL: " << times[1][0] << " / " << times[1][1] << " / " << times[1][2] << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (found[0] == found[1] && iterative.isEmpty() && recursive.isEmpty()) << std::endl;
+}
+
+void benchmarkBulkLoad() {
+    const int NUM_KEYS = 4000000;
+    std::vector<int> keys(NUM_KEYS);
+    for (int i = 0; i < NUM_KEYS; i++) {
+        keys[i] = 2 * i;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    AVLTree<int> inserted;
+    for (int key : keys) {
+        inserted.insert(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long insertTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    AVLTree<int> sequential = AVLTree<int>::fromSorted(keys);
+    end = std::chrono::high_resolution_clock::now();
+    long long sequentialTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    AVLTree<int> parallel = AVLTree<int>::fromSorted(keys, 0);
+    end = std::chrono::high_resolution_clock::now();
+    long long parallelTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    BinarySearchTree<int> bst = BinarySearchTree<int>::fromSorted(keys, 0);
+    end = std::chrono::high_resolution_clock::now();
+    long long bstTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "Loading " << NUM_KEYS << " sorted keys:" << std::endl;
+    std::cout << "AVL, n inserts:              " << insertTime << " microseconds (height "
+              << inserted.getHeight() << ")" << std::endl;
+    std::cout << "AVL::fromSorted:             " << sequentialTime << " microseconds (height "
+              << sequential.getHeight() << ")" << std::endl;
+    std::cout << "AVL::fromSorted, threads:    " << parallelTime << " microseconds" << std::endl;
+    std::cout << "BST::fromSorted, threads:    " << bstTime << " microseconds (height "
+              << bst.getHeight() << ")" << std::endl;
+    std::cout << "Contents agree: " << std::boolalpha
+              << (inserted.inorderTraversal() == parallel.inorderTraversal()
+                  && sequential.inorderTraversal() == bst.inorderTraversal()) << std::endl;
+}
+
+void benchmarkSetOperations() {
+    const int NUM_KEYS = 1000000;
+    std::vector<int> evens(NUM_KEYS);
+    std::vector<int> multiplesOfThree(NUM_KEYS);
+    for (int i = 0; i < NUM_KEYS; i++) {
+        evens[i] = 2 * i;
+        multiplesOfThree[i] = 3 * i;
+    }
+    AVLTree<int> a = AVLTree<int>::fromSorted(evens);
+    AVLTree<int> b = AVLTree<int>::fromSorted(multiplesOfThree);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    AVLTree<int> inserted(a);
+    for (int key : b.inorderTraversal()) {
+        inserted.insert(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long insertTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    AVLTree<int> sequential(a);
+    AVLTree<int> bCopy(b);
+    start = std::chrono::high_resolution_clock::now();
+    sequential.unionWith(std::move(bCopy));
+    end = std::chrono::high_resolution_clock::now();
+    long long sequentialTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    AVLTree<int> parallel(a);
+    bCopy = b;
+    start = std::chrono::high_resolution_clock::now();
+    parallel.unionWith(std::move(bCopy), 0);
+    end = std::chrono::high_resolution_clock::now();
+    long long parallelTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    AVLTree<int> intersection(a);
+    bCopy = b;
+    start = std::chrono::high_resolution_clock::now();
+    intersection.intersectWith(std::move(bCopy), 0);
+    end = std::chrono::high_resolution_clock::now();
+    long long intersectTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "Union of two " << NUM_KEYS << "-key trees:" << std::endl;
+    std::cout << "Iterate and insert:        " << insertTime << " microseconds" << std::endl;
+    std::cout << "unionWith (join-based):    " << sequentialTime << " microseconds" << std::endl;
+    std::cout << "unionWith, threads:        " << parallelTime << " microseconds" << std::endl;
+    std::cout << "intersectWith, threads:    " << intersectTime << " microseconds ("
+              << intersection.size() << " common keys)" << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (inserted.size() == sequential.size() && sequential.inorderTraversal() == parallel.inorderTraversal()
+                  && parallel.isBalanced()) << std::endl;
+}
+
+void benchmarkOrderStatistics() {
+    const int NUM_KEYS = 1000000;
+    const int NUM_QUERIES = 2000;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 45;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+
+    AVLTree<int> plain;
+    OrderStatisticAVLTree<int> augmented;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        plain.insert(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long plainInsert = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        augmented.insert(key);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long augmentedInsert = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // Percentile-style windows covering ~1% of the key space each
+    const int WINDOW = 1 << 24;
+    size_t materialized = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < NUM_QUERIES; i++) {
+        int low = keys[i] % (0x7fffffff - WINDOW);
+        materialized += plain.rangeQuery(low, low + WINDOW).size();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long rangeTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    size_t counted = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < NUM_QUERIES; i++) {
+        int low = keys[i] % (0x7fffffff - WINDOW);
+        counted += augmented.countInRange(low, low + WINDOW);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long countTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // kthSmallest on a BST: in-order walk vs subtree sizes
+    BinarySearchTree<int> bst;
+    OrderStatisticBST<int> augmentedBst;
+    for (int i = 0; i < NUM_KEYS / 10; i++) {
+        bst.insert(keys[i]);
+        augmentedBst.insert(keys[i]);
+    }
+    int bstSize = static_cast<int>(bst.size());
+    long long walkSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 1; i <= 10; i++) {
+        walkSum += bst.kthSmallest(bstSize / 10 * i);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long walkTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long selectSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 1; i <= 10; i++) {
+        selectSum += augmentedBst.kthSmallest(bstSize / 10 * i);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long selectTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << NUM_KEYS << " random keys (microseconds):" << std::endl;
+    std::cout << "Insert, plain AVL:              " << plainInsert << std::endl;
+    std::cout << "Insert, order-statistic AVL:    " << augmentedInsert << std::endl;
+    std::cout << NUM_QUERIES << " range counts, rangeQuery().size(): " << rangeTime << std::endl;
+    std::cout << NUM_QUERIES << " range counts, countInRange():      " << countTime << std::endl;
+    std::cout << "10 deciles of a " << bstSize << "-key BST, in-order walk: " << walkTime << std::endl;
+    std::cout << "10 deciles of a " << bstSize << "-key BST, subtree sizes: " << selectTime << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (materialized == counted && walkSum == selectSum
+                  && augmented.select(NUM_KEYS / 2) == plain.inorderTraversal()[NUM_KEYS / 2]) << std::endl;
+}
+
+/**
+ * Time rangeQuery over windows of the key space; returns {time, keys reported}
+ */
+template<typename Tree>
+std::vector<long long> timeRangeScans(const std::vector<int>& keys, int queries, int window) {
+    Tree tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+    long long reported = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < queries; i++) {
+        int low = keys[i] % (0x7fffffff - window);
+        reported += static_cast<long long>(tree.rangeQuery(low, low + window).size());
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return {std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), reported};
+}
+
+void benchmarkBPlusTree() {
+    const int NUM_KEYS = 1000000;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 46;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+
+    struct Row {
+        const char* name;
+        std::vector<long long> times;
+    };
+    std::vector<Row> rows = {
+        {"BST               ", timeTreeLifecycle<BinarySearchTree<int>>(keys)},
+        {"AVL               ", timeTreeLifecycle<AVLTree<int>>(keys)},
+        {"B+ tree, 128 B    ", timeTreeLifecycle<BPlusTree<int, 128>>(keys)},
+        {"B+ tree, 256 B    ", timeTreeLifecycle<BPlusTree<int, 256>>(keys)},
+        {"B+ tree, 512 B    ", timeTreeLifecycle<BPlusTree<int, 512>>(keys)},
+    };
+
+    std::cout << NUM_KEYS << " random keys (build / search / teardown, microseconds):" << std::endl;
+    bool agree = true;
+    for (const Row& row : rows) {
+        std::cout << row.name << row.times[0] << " / " << row.times[1] << " / " << row.times[2] << std::endl;
+        agree = agree && row.times[3] == rows[0].times[3];
+    }
+
+    // ~0.1% of the key space per query
+    const int QUERIES = 2000;
+    const int WINDOW = 1 << 21;
+    std::vector<long long> avlScan = timeRangeScans<AVLTree<int>>(keys, QUERIES, WINDOW);
+    std::vector<long long> bplusScan = timeRangeScans<BPlusTree<int>>(keys, QUERIES, WINDOW);
+    std::cout << QUERIES << " range queries (" << avlScan[1] / QUERIES << " keys each), AVL:     "
+              << avlScan[0] << " microseconds" << std::endl;
+    std::cout << QUERIES << " range queries (" << bplusScan[1] / QUERIES << " keys each), B+ tree: "
+              << bplusScan[0] << " microseconds" << std::endl;
+    std::cout << "Results agree: " << std::boolalpha << (agree && avlScan[1] == bplusScan[1]) << std::endl;
+}
+
+void benchmarkFrozenTree() {
+    const int NUM_KEYS = 1000000;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 47;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+    AVLTree<int> tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    FrozenTree<int> frozen = tree.freeze();
+    auto end = std::chrono::high_resolution_clock::now();
+    long long freezeTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    const char* path = "/tmp/week04_frozen_tree.bin";
+    frozen.save(path);
+    FrozenTree<int> mapped = FrozenTree<int>::load(path);
+
+    long long found[3] = {0, 0, 0};
+    long long times[3];
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found[0] += tree.contains(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[0] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found[1] += frozen.contains(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[1] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : keys) {
+        found[2] += mapped.contains(key ^ 1);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    times[2] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::remove(path);
+
+    std::cout << NUM_KEYS << " random keys, freeze() took " << freezeTime << " microseconds" << std::endl;
+    std::cout << "Node storage: AVL " << sizeof(AVLNode<int>) << " bytes/key, frozen "
+              << sizeof(int) << " bytes/key" << std::endl;
+    std::cout << NUM_KEYS << " lookups (microseconds):" << std::endl;
+    std::cout << "AVLTree::contains:          " << times[0] << std::endl;
+    std::cout << "FrozenTree::contains:       " << times[1] << std::endl;
+    std::cout << "FrozenTree::contains, mmap: " << times[2] << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (found[0] == found[1] && found[1] == found[2]
+                  && mapped.kthSmallest(NUM_KEYS / 2) == tree.inorderTraversal()[NUM_KEYS / 2 - 1]) << std::endl;
+}
+
+/**
+ * Apply updates to tree, taking a snapshot (copy) every interval updates;
+ * returns {total microseconds, snapshots taken}
+ */
+template<typename Tree>
+std::vector<long long> timeSnapshottingWriter(Tree& tree, const std::vector<int>& updates, int interval) {
+    long long snapshots = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < updates.size(); i++) {
+        if (i % 2 == 0) {
+            tree.insert(updates[i]);
+        } else {
+            tree.remove(updates[i - 1] ^ 1);
+        }
+        if (i % interval == 0) {
+            Tree snapshot(tree);
+            snapshots += snapshot.size() > 0;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return {std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), snapshots};
+}
+
+void benchmarkPersistentAVL() {
+    const int NUM_KEYS = 1000000;
+    const int NUM_UPDATES = 20000;
+    const int SNAPSHOT_INTERVAL = 1000;
+    std::vector<int> keys(NUM_KEYS + NUM_UPDATES);
+    unsigned int state = 48;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+    std::vector<int> initial(keys.begin(), keys.begin() + NUM_KEYS);
+    std::vector<int> updates(keys.begin() + NUM_KEYS, keys.end());
+
+    AVLTree<int> mutableTree;
+    PersistentAVLTree<int> persistentTree;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int key : initial) {
+        mutableTree.insert(key);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long mutableBuild = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int key : initial) {
+        persistentTree.insert(key);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long persistentBuild = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::vector<long long> mutableRun = timeSnapshottingWriter(mutableTree, updates, SNAPSHOT_INTERVAL);
+    std::vector<long long> persistentRun = timeSnapshottingWriter(persistentTree, updates, SNAPSHOT_INTERVAL);
+
+    std::cout << NUM_KEYS << " random inserts (microseconds):" << std::endl;
+    std::cout << "AVLTree:           " << mutableBuild << std::endl;
+    std::cout << "PersistentAVLTree: " << persistentBuild << " (path copying)" << std::endl;
+    std::cout << NUM_UPDATES << " updates with a snapshot every " << SNAPSHOT_INTERVAL
+              << " (microseconds):" << std::endl;
+    std::cout << "AVLTree, deep copy:          " << mutableRun[0] << std::endl;
+    std::cout << "PersistentAVLTree, snapshot: " << persistentRun[0] << std::endl;
+    std::cout << "Results agree: " << std::boolalpha
+              << (mutableRun[1] == persistentRun[1]
+                  && mutableTree.inorderTraversal() == persistentTree.inorderTraversal()) << std::endl;
+}
+
+/**
+ * The usual way to share an AVLTree: one reader-writer lock around it
+ */
+class LockedAVLSet {
+private:
+    AVLTree<int> tree;
+    mutable std::shared_mutex lock;
+
+public:
+    bool insert(int key) {
+        std::unique_lock<std::shared_mutex> guard(lock);
+        if (tree.contains(key)) {
+            return false;
+        }
+        tree.insert(key);
+        return true;
+    }
+
+    bool remove(int key) {
+        std::unique_lock<std::shared_mutex> guard(lock);
+        if (!tree.contains(key)) {
+            return false;
+        }
+        tree.remove(key);
+        return true;
+    }
+
+    bool contains(int key) const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        return tree.contains(key);
+    }
+};
+
+/**
+ * Run totalOps operations split over threads, readPercent of them lookups
+ * and the rest inserts and removes in equal parts; returns {microseconds,
+ * lookups that found their key}
+ */
+template<typename Set>
+std::vector<long long> timeMixedWorkload(int threads, int readPercent, int totalOps, int keyRange) {
+    Set set;
+    unsigned int state = 49;
+    for (int i = 0; i < keyRange / 2; i++) {
+        state = state * 1103515245u + 12345u;
+        set.insert(static_cast<int>((state >> 1) % keyRange));
+    }
+
+    std::atomic<long long> hits(0);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&set, &hits, t, threads, readPercent, totalOps, keyRange]() {
+            unsigned int local = 1000u + t;
+            long long found = 0;
+            for (int i = t; i < totalOps; i += threads) {
+                local = local * 1103515245u + 12345u;
+                int key = static_cast<int>((local >> 1) % keyRange);
+                int dice = static_cast<int>((local >> 8) % 100);
+                if (dice < readPercent) {
+                    found += set.contains(key);
+                } else if (dice % 2 == 0) {
+                    set.insert(key);
+                } else {
+                    set.remove(key);
+                }
+            }
+            hits += found;
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return {std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), hits.load()};
+}
+
+void benchmarkConcurrentBST() {
+    const int TOTAL_OPS = 400000;
+    const int KEY_RANGE = 200000;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << TOTAL_OPS << " operations over " << KEY_RANGE / 2
+              << " keys (Mops/s, ConcurrentBST vs AVLTree + shared_mutex):" << std::endl;
+    std::cout << "threads   90/10 reads/writes   50/50 reads/writes" << std::endl;
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        std::cout << threads << (threads < 10 ? "         " : "        ");
+        for (int readPercent : {90, 50}) {
+            std::vector<long long> fine = timeMixedWorkload<ConcurrentBST<int>>(threads, readPercent, TOTAL_OPS, KEY_RANGE);
+            std::vector<long long> locked = timeMixedWorkload<LockedAVLSet>(threads, readPercent, TOTAL_OPS, KEY_RANGE);
+            double fineRate = static_cast<double>(TOTAL_OPS) / std::max(1LL, fine[0]);
+            double lockedRate = static_cast<double>(TOTAL_OPS) / std::max(1LL, locked[0]);
+            char cell[32];
+            std::snprintf(cell, sizeof(cell), "%5.2f vs %5.2f", fineRate, lockedRate);
+            std::cout << cell << "       ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+void benchmarkLazyIterators() {
+    const int NUM_KEYS = 1000000;
+    const int QUERIES = 10;
+    const int PAGE = 20;
+    std::vector<int> keys(NUM_KEYS);
+    unsigned int state = 50;
+    for (int& key : keys) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+    AVLTree<int> tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+
+    // Top PAGE keys: materialize everything vs stop after PAGE steps
+    long long eagerSum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        std::vector<int> all = tree.inorderTraversal();
+        for (int i = 0; i < PAGE; i++) {
+            eagerSum += all[i];
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long eagerTop = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    long long lazySum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        auto it = tree.begin();
+        for (int i = 0; i < PAGE; i++, ++it) {
+            lazySum += *it;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long lazyTop = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // One page from a random key: rangeQuery to the end and sort vs range()
+    std::vector<int> starts(QUERIES);
+    for (int& key : starts) {
+        state = state * 1103515245u + 12345u;
+        key = static_cast<int>(state >> 1);
+    }
+    start = std::chrono::high_resolution_clock::now();
+    for (int low : starts) {
+        std::vector<int> tail = tree.rangeQuery(low, 0x7fffffff);
+        size_t count = std::min<size_t>(PAGE, tail.size());
+        std::partial_sort(tail.begin(), tail.begin() + count, tail.end());
+        for (size_t i = 0; i < count; i++) {
+            eagerSum += tail[i];
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long eagerPage = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int low : starts) {
+        int taken = 0;
+        for (int key : tree.range(low, 0x7fffffff)) {
+            if (taken++ == PAGE) {
+                break;
+            }
+            lazySum += key;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    long long lazyPage = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << QUERIES << " queries of " << PAGE << " keys over " << NUM_KEYS << " keys (microseconds):" << std::endl;
+    std::cout << "Smallest keys, inorderTraversal: " << eagerTop << std::endl;
+    std::cout << "Smallest keys, begin():          " << lazyTop << std::endl;
+    std::cout << "Page after a key, rangeQuery:    " << eagerPage << std::endl;
+    std::cout << "Page after a key, range():       " << lazyPage << std::endl;
+    std::cout << "Results agree: " << std::boolalpha << (eagerSum == lazySum) << std::endl;
+}
+
 int main() {
     std::cout << "======================================" << std::endl;
     std::cout << " DSA Week 4: Binary Trees Demonstration" << std::endl;
@@ -85,6 +747,76 @@ int main() {
         std::cout << "BST is " << (bstSearchTime / (double)avlSearchTime) << "x slower than AVL" << std::endl;
     }
     
+    std::cout << "\n\n";
+    
+    // Node allocation strategies
+    std::cout << "5. Node Allocation:" << std::endl;
+    std::cout << "-------------------" << std::endl;
+    benchmarkNodeAllocation();
+    
+    std::cout << "\n\n";
+    
+    // Iterative vs. recursive AVL operations
+    std::cout << "6. Iterative AVL Operations:" << std::endl;
+    std::cout << "----------------------------" << std::endl;
+    benchmarkIterativeAVL();
+    
+    std::cout << "\n\n";
+    
+    // O(n) construction from sorted keys
+    std::cout << "7. Bulk Load from Sorted Keys:" << std::endl;
+    std::cout << "------------------------------" << std::endl;
+    benchmarkBulkLoad();
+    
+    std::cout << "\n\n";
+    
+    // Join-based set operations
+    std::cout << "8. Join-Based Set Operations:" << std::endl;
+    std::cout << "-----------------------------" << std::endl;
+    benchmarkSetOperations();
+    
+    std::cout << "\n\n";
+    
+    // Order-statistic queries
+    std::cout << "9. Order Statistics:" << std::endl;
+    std::cout << "--------------------" << std::endl;
+    benchmarkOrderStatistics();
+    
+    std::cout << "\n\n";
+    
+    // Cache-friendly B+ tree vs the binary trees
+    std::cout << "10. B+ Tree vs BST vs AVL:" << std::endl;
+    std::cout << "--------------------------" << std::endl;
+    benchmarkBPlusTree();
+    
+    std::cout << "\n\n";
+    
+    // Read-only snapshot
+    std::cout << "11. Frozen Eytzinger Snapshot:" << std::endl;
+    std::cout << "------------------------------" << std::endl;
+    benchmarkFrozenTree();
+    
+    std::cout << "\n\n";
+    
+    // O(1) snapshots through path copying
+    std::cout << "12. Persistent AVL Snapshots:" << std::endl;
+    std::cout << "-----------------------------" << std::endl;
+    benchmarkPersistentAVL();
+    
+    std::cout << "\n\n";
+    
+    // Many threads on one tree
+    std::cout << "13. Concurrent BST Scalability:" << std::endl;
+    std::cout << "-------------------------------" << std::endl;
+    benchmarkConcurrentBST();
+    
+    std::cout << "\n\n";
+    
+    // Iterators that stop when the caller does
+    std::cout << "14. Lazy Iterators vs Vectors:" << std::endl;
+    std::cout << "------------------------------" << std::endl;
+    benchmarkLazyIterators();
+    
     std::cout << "\n======================================" << std::endl;
     std::cout << " Week 4 Demonstration Complete!" << std::endl;
     std::cout << "======================================" << std::endl;
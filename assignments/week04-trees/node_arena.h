@@ -0,0 +1,211 @@
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Node allocators for the pointer-based trees
+ * BinarySearchTree and AVLTree take the allocator as a template argument.
+ * An allocator provides:
+ *   create(args...)  construct a node
+ *   destroy(node)    destroy a single node (remove)
+ *   allocateSlots(n) uninitialized storage for n adjacent nodes that are
+ *                    constructed in place and may be destroyed one by one
+ *                    later, or nullptr if the allocator cannot provide it
+ *   releaseAll()     free every node at once; destructors are skipped, so
+ *                    trees call it alone only when BULK_RELEASE is true
+ *   shareChunks(a)   keep a's storage alive for as long as this allocator,
+ *                    so nodes created by a can be handed to this tree
+ *
+ * SlabArena (the default) carves nodes out of large chunks with a bump
+ * pointer and recycles removed nodes through a free list. Nodes created
+ * one after another are adjacent in memory, and trees clone level by
+ * level so siblings end up side by side. Dropping a whole tree frees its
+ * chunks: O(chunks) instead of one free() per node.
+ *
+ * Chunks live in reference-counted pools. When set operations move nodes
+ * from one tree to another, the receiving arena takes a reference to the
+ * donor's pools, and a pool is freed once no arena refers to it.
+ *
+ * HeapAllocator is plain new/delete, kept for comparison.
+ */
+
+template<typename Node>
+class HeapAllocator {
+public:
+    static constexpr bool BULK_RELEASE = false;
+
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node* node) {
+        delete node;
+    }
+
+    Node* allocateSlots(size_t) {
+        return nullptr;
+    }
+
+    void releaseAll() {}
+
+    void shareChunks(HeapAllocator&) {}
+
+    void swap(HeapAllocator&) {}
+};
+
+template<typename Node, size_t MaxChunkNodes = 65536>
+class SlabArena {
+private:
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct ChunkPool {
+        std::vector<Slot*> chunks;
+
+        ~ChunkPool() {
+            for (Slot* chunk : chunks) {
+                delete[] chunk;
+            }
+        }
+    };
+
+    static constexpr size_t FIRST_CHUNK_NODES = 64;
+
+    // pools[0] is this arena's own pool; the rest were shared by other arenas
+    std::vector<std::shared_ptr<ChunkPool>> pools;
+    Slot* cursor;
+    Slot* chunkEnd;
+    Slot* freeSlots;
+    size_t nextChunkNodes;
+
+    ChunkPool& ownPool() {
+        if (pools.empty()) {
+            pools.push_back(std::make_shared<ChunkPool>());
+        }
+        return *pools[0];
+    }
+
+    void addChunk() {
+        Slot* chunk = new Slot[nextChunkNodes];
+        ownPool().chunks.push_back(chunk);
+        cursor = chunk;
+        chunkEnd = chunk + nextChunkNodes;
+        if (nextChunkNodes < MaxChunkNodes) {
+            nextChunkNodes *= 2;
+        }
+    }
+
+public:
+    // Nodes without destructors can be dropped together with their chunks
+    static constexpr bool BULK_RELEASE = std::is_trivially_destructible<Node>::value;
+
+    SlabArena() : cursor(nullptr), chunkEnd(nullptr), freeSlots(nullptr), nextChunkNodes(FIRST_CHUNK_NODES) {}
+
+    SlabArena(const SlabArena&) = delete;
+    SlabArena& operator=(const SlabArena&) = delete;
+
+    ~SlabArena() {
+        releaseAll();
+    }
+
+    /**
+     * Construct a node, reusing a freed slot if there is one
+     * Time Complexity: O(1) amortized
+     * Space Complexity: O(1) amortized
+     */
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        Slot* slot;
+        if (freeSlots != nullptr) {
+            slot = freeSlots;
+            freeSlots = slot->next;
+        } else {
+            if (cursor == chunkEnd) {
+                addChunk();
+            }
+            slot = cursor++;
+        }
+        return new (slot->storage) Node(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroy a node and put its slot on the free list
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    void destroy(Node* node) {
+        node->~Node();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = freeSlots;
+        freeSlots = slot;
+    }
+
+    /**
+     * Dedicated chunk of count adjacent slots for bulk construction
+     * Time Complexity: O(1)
+     * Space Complexity: O(count)
+     */
+    Node* allocateSlots(size_t count) {
+        static_assert(sizeof(Slot) == sizeof(Node), "slots must be laid out like a Node array");
+        if (count == 0) {
+            return nullptr;
+        }
+        Slot* chunk = new Slot[count];
+        ownPool().chunks.push_back(chunk);
+        return reinterpret_cast<Node*>(chunk);
+    }
+
+    /**
+     * Free every chunk without running node destructors (chunks still
+     * referenced by another arena are freed when that arena lets go)
+     * Time Complexity: O(chunks)
+     * Space Complexity: O(1)
+     */
+    void releaseAll() {
+        pools.clear();
+        cursor = chunkEnd = freeSlots = nullptr;
+        nextChunkNodes = FIRST_CHUNK_NODES;
+    }
+
+    /**
+     * Keep other's chunks alive as long as this arena
+     * Time Complexity: O(pools)
+     * Space Complexity: O(pools)
+     */
+    void shareChunks(SlabArena& other) {
+        ownPool();
+        for (const std::shared_ptr<ChunkPool>& pool : other.pools) {
+            if (std::find(pools.begin(), pools.end(), pool) == pools.end()) {
+                pools.push_back(pool);
+            }
+        }
+    }
+
+    void swap(SlabArena& other) {
+        pools.swap(other.pools);
+        std::swap(cursor, other.cursor);
+        std::swap(chunkEnd, other.chunkEnd);
+        std::swap(freeSlots, other.freeSlots);
+        std::swap(nextChunkNodes, other.nextChunkNodes);
+    }
+
+    size_t chunkCount() const {
+        size_t count = 0;
+        for (const std::shared_ptr<ChunkPool>& pool : pools) {
+            count += pool->chunks.size();
+        }
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef ORDER_STATISTICS_H
+#define ORDER_STATISTICS_H
+
+#include <cstddef>
+
+/**
+ * Order-statistic walks over trees whose nodes record the size of their
+ * subtree in node->size. Used by BinarySearchTree and AVLTree when they
+ * are instantiated with OrderStatistics = true.
+ */
+
+template<typename Node>
+inline size_t subtreeSize(const Node* node) {
+    return node == nullptr ? 0 : static_cast<size_t>(node->size);
+}
+
+/**
+ * Node holding the key with exactly index smaller keys in node's subtree
+ * (index must be below the subtree size)
+ * Time Complexity: O(h)
+ * Space Complexity: O(1)
+ */
+template<typename Node>
+Node* selectNode(Node* node, size_t index) {
+    while (true) {
+        size_t leftSize = subtreeSize(node->left);
+        if (index < leftSize) {
+            node = node->left;
+        } else if (index > leftSize) {
+            index -= leftSize + 1;
+            node = node->right;
+        } else {
+            return node;
+        }
+    }
+}
+
+/**
+ * Number of keys in node's subtree that are < key, or <= key when
+ * inclusive is set
+ * Time Complexity: O(h)
+ * Space Complexity: O(1)
+ */
+template<typename Node, typename T>
+size_t countBelow(const Node* node, const T& key, bool inclusive) {
+    size_t count = 0;
+    while (node != nullptr) {
+        if (inclusive ? !(key < node->data) : node->data < key) {
+            count += subtreeSize(node->left) + 1;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return count;
+}
+
+#endif
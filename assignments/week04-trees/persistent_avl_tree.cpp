@@ -0,0 +1,482 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * Persistent AVL Tree Implementation
+ * Copying an AVLTree clones every node. Here nodes are immutable once
+ * built and shared between versions of the tree: insert and remove copy
+ * only the O(log n) nodes on the path to the change (path copying) and
+ * point the copies at the untouched subtrees of the old version. Copying
+ * the tree, i.e. taking a snapshot, is O(1).
+ *
+ * Each node counts the trees and parent nodes that reference it (atomic
+ * intrusive count); a node is freed, and its children released, when the
+ * last reference goes.
+ *
+ * Threading: a single tree object is not synchronized, like any other
+ * container. Distinct copies may be used on different threads at the
+ * same time, even though they share nodes, because shared nodes are
+ * never modified. So a writer thread can keep updating its tree and hand
+ * snapshot() copies to readers; readers never lock or wait, and the
+ * writer never waits for them.
+ */
+
+template<typename T>
+struct PersistentAVLNode {
+    T data;
+    const PersistentAVLNode* left;
+    const PersistentAVLNode* right;
+    int height;
+    mutable std::atomic<int> references;
+    
+    PersistentAVLNode(const T& value, const PersistentAVLNode* l, const PersistentAVLNode* r)
+        : data(value), left(l), right(r),
+          height(1 + std::max(l == nullptr ? -1 : l->height, r == nullptr ? -1 : r->height)),
+          references(1) {}
+};
+
+template<typename T>
+class PersistentAVLTree {
+private:
+    using Node = PersistentAVLNode<T>;
+    
+    const Node* root;
+    size_t nodeCount;
+    
+    // An AVL tree of height h holds at least Fib(h + 3) - 1 nodes
+    static constexpr int MAX_DEPTH = 128;
+    
+    static int getHeight(const Node* node) {
+        return (node == nullptr) ? -1 : node->height;
+    }
+    
+    /**
+     * Take one more reference to node
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    static const Node* retain(const Node* node) {
+        if (node != nullptr) {
+            node->references.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+    
+    /**
+     * Drop one reference to node; nodes whose count reaches zero are
+     * freed and release their children in turn
+     * Time Complexity: O(1) amortized per freed node
+     * Space Complexity: O(log n)
+     */
+    static void release(const Node* node) {
+        const Node* stack[2 * MAX_DEPTH];
+        int top = 0;
+        if (node != nullptr) {
+            stack[top++] = node;
+        }
+        while (top > 0) {
+            const Node* current = stack[--top];
+            if (current->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                continue;
+            }
+            if (current->left != nullptr) {
+                stack[top++] = current->left;
+            }
+            if (current->right != nullptr) {
+                stack[top++] = current->right;
+            }
+            delete current;
+        }
+    }
+    
+    /**
+     * Build a node over data and two subtrees whose heights differ by at
+     * most two, rotating if needed. Takes over the caller's references to
+     * left and right and returns a new reference.
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    static const Node* balance(const T& data, const Node* left, const Node* right) {
+        if (getHeight(left) > getHeight(right) + 1) {
+            const Node* outer = left->left;
+            const Node* inner = left->right;
+            const Node* result;
+            if (getHeight(outer) >= getHeight(inner)) {
+                // Single right rotation
+                result = new Node(left->data, retain(outer), new Node(data, retain(inner), right));
+            } else {
+                // Left-right rotation: inner becomes the root
+                result = new Node(inner->data,
+                                  new Node(left->data, retain(outer), retain(inner->left)),
+                                  new Node(data, retain(inner->right), right));
+            }
+            release(left);
+            return result;
+        }
+        if (getHeight(right) > getHeight(left) + 1) {
+            const Node* outer = right->right;
+            const Node* inner = right->left;
+            const Node* result;
+            if (getHeight(outer) >= getHeight(inner)) {
+                // Single left rotation
+                result = new Node(right->data, new Node(data, left, retain(inner)), retain(outer));
+            } else {
+                // Right-left rotation
+                result = new Node(inner->data,
+                                  new Node(data, left, retain(inner->left)),
+                                  new Node(right->data, retain(inner->right), retain(outer)));
+            }
+            release(right);
+            return result;
+        }
+        return new Node(data, left, right);
+    }
+    
+    /**
+     * Path-copying insert; returns a new reference to the updated
+     * subtree, or nullptr if value is already present (nothing copied)
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes and recursion
+     */
+    static const Node* insert(const Node* node, const T& value) {
+        if (node == nullptr) {
+            return new Node(value, nullptr, nullptr);
+        }
+        if (value < node->data) {
+            const Node* left = insert(node->left, value);
+            return left == nullptr ? nullptr : balance(node->data, left, retain(node->right));
+        }
+        if (node->data < value) {
+            const Node* right = insert(node->right, value);
+            return right == nullptr ? nullptr : balance(node->data, retain(node->left), right);
+        }
+        return nullptr; // Duplicate values are not allowed
+    }
+    
+    /**
+     * Copy of node's subtree without its minimum; new reference
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n)
+     */
+    static const Node* removeMin(const Node* node) {
+        if (node->left == nullptr) {
+            return retain(node->right);
+        }
+        return balance(node->data, removeMin(node->left), retain(node->right));
+    }
+    
+    /**
+     * Path-copying remove; sets found and returns a new reference to the
+     * updated subtree (nothing is copied when value is absent)
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes and recursion
+     */
+    static const Node* remove(const Node* node, const T& value, bool& found) {
+        if (node == nullptr) {
+            found = false;
+            return nullptr;
+        }
+        if (value < node->data) {
+            const Node* left = remove(node->left, value, found);
+            return found ? balance(node->data, left, retain(node->right)) : nullptr;
+        }
+        if (node->data < value) {
+            const Node* right = remove(node->right, value, found);
+            return found ? balance(node->data, retain(node->left), right) : nullptr;
+        }
+        
+        found = true;
+        if (node->left == nullptr) {
+            return retain(node->right);
+        }
+        if (node->right == nullptr) {
+            return retain(node->left);
+        }
+        const Node* successor = node->right;
+        while (successor->left != nullptr) {
+            successor = successor->left;
+        }
+        return balance(successor->data, retain(node->left), removeMin(node->right));
+    }
+    
+    static bool isBalanced(const Node* node) {
+        if (node == nullptr) {
+            return true;
+        }
+        int balance = getHeight(node->left) - getHeight(node->right);
+        return std::abs(balance) <= 1 && isBalanced(node->left) && isBalanced(node->right);
+    }
+
+public:
+    /**
+     * Default constructor
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    PersistentAVLTree() : root(nullptr), nodeCount(0) {}
+    
+    /**
+     * Copy constructor - shares every node with other
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    PersistentAVLTree(const PersistentAVLTree& other) : root(retain(other.root)), nodeCount(other.nodeCount) {}
+    
+    /**
+     * Assignment operator
+     * Time Complexity: O(1), plus O(k) to free the k nodes only this
+     *                  tree still referenced
+     * Space Complexity: O(log n)
+     */
+    PersistentAVLTree& operator=(const PersistentAVLTree& other) {
+        if (this != &other) {
+            const Node* old = root;
+            root = retain(other.root);
+            nodeCount = other.nodeCount;
+            release(old);
+        }
+        return *this;
+    }
+    
+    /**
+     * Move constructor
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    PersistentAVLTree(PersistentAVLTree&& other) noexcept : root(other.root), nodeCount(other.nodeCount) {
+        other.root = nullptr;
+        other.nodeCount = 0;
+    }
+    
+    /**
+     * Move assignment operator
+     * Time Complexity: O(1), plus O(k) as for assignment
+     * Space Complexity: O(log n)
+     */
+    PersistentAVLTree& operator=(PersistentAVLTree&& other) noexcept {
+        if (this != &other) {
+            std::swap(root, other.root);
+            std::swap(nodeCount, other.nodeCount);
+            other.makeEmpty();
+        }
+        return *this;
+    }
+    
+    /**
+     * Destructor - frees the nodes no other version shares
+     * Time Complexity: O(k) for the k unshared nodes
+     * Space Complexity: O(log n)
+     */
+    ~PersistentAVLTree() {
+        release(root);
+    }
+    
+    /**
+     * The current version as a separate tree, safe to hand to another
+     * thread; later updates to either tree do not affect the other
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    PersistentAVLTree snapshot() const {
+        return *this;
+    }
+    
+    /**
+     * Insert a value into the tree
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes
+     */
+    void insert(const T& value) {
+        const Node* updated = insert(root, value);
+        if (updated != nullptr) {
+            release(root);
+            root = updated;
+            nodeCount++;
+        }
+    }
+    
+    /**
+     * Remove a value from the tree
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes
+     */
+    void remove(const T& value) {
+        bool found = false;
+        const Node* updated = remove(root, value, found);
+        if (found) {
+            release(root);
+            root = updated;
+            nodeCount--;
+        }
+    }
+    
+    /**
+     * Check if value exists in tree
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    bool contains(const T& value) const {
+        const Node* node = root;
+        while (node != nullptr) {
+            if (value == node->data) {
+                return true;
+            } else if (value < node->data) {
+                node = node->left;
+            } else {
+                node = node->right;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * Find minimum value in tree
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T findMin() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        const Node* node = root;
+        while (node->left != nullptr) {
+            node = node->left;
+        }
+        return node->data;
+    }
+    
+    /**
+     * Find maximum value in tree
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T findMax() const {
+        if (isEmpty()) {
+            throw std::runtime_error("Tree is empty");
+        }
+        const Node* node = root;
+        while (node->right != nullptr) {
+            node = node->right;
+        }
+        return node->data;
+    }
+    
+    /**
+     * Check if tree is empty
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool isEmpty() const {
+        return root == nullptr;
+    }
+    
+    /**
+     * Get number of nodes in tree
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    size_t size() const {
+        return nodeCount;
+    }
+    
+    /**
+     * Get height of tree
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    int getHeight() const {
+        return getHeight(root);
+    }
+    
+    /**
+     * Drop this version (shared nodes stay alive for other versions)
+     * Time Complexity: O(k) for the k unshared nodes
+     * Space Complexity: O(log n)
+     */
+    void makeEmpty() {
+        release(root);
+        root = nullptr;
+        nodeCount = 0;
+    }
+    
+    /**
+     * Check if tree is balanced (for testing)
+     * Time Complexity: O(n)
+     * Space Complexity: O(log n)
+     */
+    bool isBalanced() const {
+        return isBalanced(root);
+    }
+    
+    /**
+     * Check whether two versions share their root, i.e. are the same version
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    bool sharesRootWith(const PersistentAVLTree& other) const {
+        return root == other.root;
+    }
+    
+    /**
+     * Inorder traversal (sorted order)
+     * Time Complexity: O(n)
+     * Space Complexity: O(log n)
+     */
+    std::vector<T> inorderTraversal() const {
+        std::vector<T> result;
+        result.reserve(nodeCount);
+        const Node* stack[MAX_DEPTH];
+        int top = 0;
+        const Node* current = root;
+        
+        while (current != nullptr || top > 0) {
+            while (current != nullptr) {
+                stack[top++] = current;
+                current = current->left;
+            }
+            current = stack[--top];
+            result.push_back(current->data);
+            current = current->right;
+        }
+        return result;
+    }
+    
+    /**
+     * Range query: find all values in [low, high], in sorted order
+     * Time Complexity: O(log n + k) where k is number of results
+     * Space Complexity: O(log n + k)
+     */
+    std::vector<T> rangeQuery(const T& low, const T& high) const {
+        std::vector<T> result;
+        const Node* stack[MAX_DEPTH];
+        int top = 0;
+        const Node* current = root;
+        
+        while (current != nullptr || top > 0) {
+            // Only descend left while keys there can still be >= low
+            while (current != nullptr) {
+                if (current->data < low) {
+                    current = current->right;
+                } else {
+                    stack[top++] = current;
+                    current = current->left;
+                }
+            }
+            if (top == 0) {
+                break;
+            }
+            current = stack[--top];
+            if (high < current->data) {
+                break;
+            }
+            result.push_back(current->data);
+            current = current->right;
+        }
+        return result;
+    }
+};
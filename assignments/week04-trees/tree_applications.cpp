@@ -6,6 +6,7 @@
 #include <unordered_set>
 #include <algorithm>
 #include <limits>
+#include "tree_node.h"
 
 /**
  * Advanced Tree Applications and Algorithms
@@ -13,16 +14,6 @@
  * and applications commonly used in computer science
  */
 
-// Generic tree node for general tree algorithms
-template<typename T>
-struct TreeNode {
-    T data;
-    TreeNode* left;
-    TreeNode* right;
-    
-    TreeNode(const T& value) : data(value), left(nullptr), right(nullptr) {}
-};
-
 /**
  * Tree Validation Algorithms
  */
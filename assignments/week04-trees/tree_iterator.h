@@ -0,0 +1,270 @@
+#ifndef TREE_ITERATOR_H
+#define TREE_ITERATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * Lazy in-order iterator over a binary search tree whose nodes have data,
+ * left and right. Used by BinarySearchTree and AVLTree.
+ * The iterator keeps the path from the root to its node instead of
+ * relying on parent pointers, so nodes stay as small as they are and no
+ * update has to maintain extra links. Stepping is O(1) amortized and
+ * touches only the nodes between two neighbours. The first InlineDepth
+ * path entries live inside the iterator; deeper paths (only a degenerate
+ * BinarySearchTree gets there) spill to the heap. AVLTree passes its
+ * MAX_DEPTH, so its iterators never allocate.
+ * Keys are read-only through the iterator. Any insert or remove
+ * invalidates every iterator of that tree.
+ */
+
+template<typename T, typename Node, size_t InlineDepth = 32>
+class TreeIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+private:
+    static_assert(InlineDepth > 0, "Path needs at least one inline slot");
+    
+    /**
+     * Stack of nodes with a fixed inline buffer and a heap overflow
+     */
+    class Path {
+    private:
+        const Node* nodes[InlineDepth];
+        std::vector<const Node*> spill;  // entries past InlineDepth
+        size_t count;
+        
+    public:
+        Path() : count(0) {}
+        
+        // Copies only the live entries
+        Path(const Path& other) : spill(other.spill), count(other.count) {
+            std::copy(other.nodes, other.nodes + std::min(count, InlineDepth), nodes);
+        }
+        
+        Path& operator=(const Path& other) {
+            if (this != &other) {
+                spill = other.spill;
+                count = other.count;
+                std::copy(other.nodes, other.nodes + std::min(count, InlineDepth), nodes);
+            }
+            return *this;
+        }
+        
+        void push_back(const Node* node) {
+            if (count < InlineDepth) {
+                nodes[count] = node;
+            } else {
+                spill.push_back(node);
+            }
+            count++;
+        }
+        
+        void pop_back() {
+            count--;
+            if (count >= InlineDepth) {
+                spill.pop_back();
+            }
+        }
+        
+        const Node* back() const {
+            return count <= InlineDepth ? nodes[count - 1] : spill.back();
+        }
+        
+        // Only ever shrinks
+        void resize(size_t newCount) {
+            count = newCount;
+            spill.resize(count > InlineDepth ? count - InlineDepth : 0);
+        }
+        
+        size_t size() const {
+            return count;
+        }
+        
+        bool empty() const {
+            return count == 0;
+        }
+    };
+    
+    const Node* root;
+    Path path;  // root ... current node; empty at end()
+
+    explicit TreeIterator(const Node* treeRoot) : root(treeRoot) {}
+
+    void descendLeft(const Node* node) {
+        for (; node != nullptr; node = node->left) {
+            path.push_back(node);
+        }
+    }
+
+    void descendRight(const Node* node) {
+        for (; node != nullptr; node = node->right) {
+            path.push_back(node);
+        }
+    }
+
+    /**
+     * Position on the first key that is not below value (inclusive) or
+     * not at or below it (!inclusive); the path is cut back to the last
+     * node where the search turned left
+     */
+    template<bool Inclusive>
+    static TreeIterator bound(const Node* treeRoot, const T& value) {
+        TreeIterator it(treeRoot);
+        size_t keep = 0;
+        for (const Node* node = treeRoot; node != nullptr;) {
+            it.path.push_back(node);
+            bool goRight = Inclusive ? node->data < value : !(value < node->data);
+            if (goRight) {
+                node = node->right;
+            } else {
+                keep = it.path.size();
+                node = node->left;
+            }
+        }
+        it.path.resize(keep);
+        return it;
+    }
+
+public:
+    TreeIterator() : root(nullptr) {}
+
+    /**
+     * Iterator to the smallest key
+     * Time Complexity: O(h)
+     * Space Complexity: O(h)
+     */
+    static TreeIterator first(const Node* treeRoot) {
+        TreeIterator it(treeRoot);
+        it.descendLeft(treeRoot);
+        return it;
+    }
+
+    /**
+     * Past-the-end iterator
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    static TreeIterator last(const Node* treeRoot) {
+        return TreeIterator(treeRoot);
+    }
+
+    /**
+     * Iterator to the first key >= value / > value
+     * Time Complexity: O(h)
+     * Space Complexity: O(h)
+     */
+    static TreeIterator lowerBound(const Node* treeRoot, const T& value) {
+        return bound<true>(treeRoot, value);
+    }
+
+    static TreeIterator upperBound(const Node* treeRoot, const T& value) {
+        return bound<false>(treeRoot, value);
+    }
+
+    reference operator*() const {
+        return path.back()->data;
+    }
+
+    pointer operator->() const {
+        return &path.back()->data;
+    }
+
+    /**
+     * Step to the next key: the leftmost node of the right subtree, or
+     * else the nearest ancestor reached from its left
+     * Time Complexity: O(1) amortized, O(h) worst case
+     * Space Complexity: O(1)
+     */
+    TreeIterator& operator++() {
+        const Node* node = path.back();
+        if (node->right != nullptr) {
+            descendLeft(node->right);
+            return *this;
+        }
+        path.pop_back();
+        while (!path.empty() && path.back()->right == node) {
+            node = path.back();
+            path.pop_back();
+        }
+        return *this;
+    }
+
+    /**
+     * Step to the previous key; from end() this is the largest key
+     * Time Complexity: O(1) amortized, O(h) worst case
+     * Space Complexity: O(1)
+     */
+    TreeIterator& operator--() {
+        if (path.empty()) {
+            descendRight(root);
+            return *this;
+        }
+        const Node* node = path.back();
+        if (node->left != nullptr) {
+            descendRight(node->left);
+            return *this;
+        }
+        path.pop_back();
+        while (!path.empty() && path.back()->left == node) {
+            node = path.back();
+            path.pop_back();
+        }
+        return *this;
+    }
+
+    TreeIterator operator++(int) {
+        TreeIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    TreeIterator operator--(int) {
+        TreeIterator previous = *this;
+        --*this;
+        return previous;
+    }
+
+    bool operator==(const TreeIterator& other) const {
+        return (path.empty() ? nullptr : path.back()) == (other.path.empty() ? nullptr : other.path.back());
+    }
+
+    bool operator!=(const TreeIterator& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Pair of iterators usable in a range-based for loop; nothing is read
+ * until it is iterated
+ */
+template<typename Iterator>
+class TreeRange {
+private:
+    Iterator first;
+    Iterator last;
+
+public:
+    TreeRange(Iterator begin, Iterator end) : first(begin), last(end) {}
+
+    Iterator begin() const {
+        return first;
+    }
+
+    Iterator end() const {
+        return last;
+    }
+
+    bool empty() const {
+        return first == last;
+    }
+};
+
+#endif
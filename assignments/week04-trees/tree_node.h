@@ -0,0 +1,18 @@
+#ifndef TREE_NODE_H
+#define TREE_NODE_H
+
+/**
+ * Binary tree node shared by BinarySearchTree and the tree applications
+ */
+
+template<typename T>
+struct TreeNode {
+    T data;
+    int size;  // Nodes in this subtree; kept only by order-statistic trees
+    TreeNode* left;
+    TreeNode* right;
+    
+    TreeNode(const T& value) : data(value), size(1), left(nullptr), right(nullptr) {}
+};
+
+#endif
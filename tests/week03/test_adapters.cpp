@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/applications.cpp"
+#include <queue>
+#include <random>
+#include <stack>
+#include <stdexcept>
+#include <string>
+
+// StackUsingQueues Tests
+TEST(StackUsingQueuesTest, LIFOOrder) {
+    StackUsingQueues<int> stack;
+    EXPECT_TRUE(stack.empty());
+    EXPECT_THROW(stack.pop(), std::underflow_error);
+    EXPECT_THROW(stack.top(), std::underflow_error);
+
+    for (int i = 1; i <= 5; i++) {
+        stack.push(i);
+    }
+    EXPECT_EQ(stack.size(), 5);
+    EXPECT_EQ(stack.top(), 5);
+    for (int i = 5; i >= 1; i--) {
+        EXPECT_EQ(stack.pop(), i);
+    }
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(StackUsingQueuesTest, RandomizedAgainstStdStack) {
+    StackUsingQueues<std::string> stack;
+    std::stack<std::string> reference;
+    std::mt19937 rng(17);
+
+    for (int i = 0; i < 20000; i++) {
+        if (rng() % 3 != 0 || reference.empty()) {
+            std::string value = std::to_string(rng() % 1000);
+            stack.push(value);
+            reference.push(value);
+        } else {
+            ASSERT_EQ(stack.top(), reference.top());
+            ASSERT_EQ(stack.pop(), reference.top());
+            reference.pop();
+        }
+        ASSERT_EQ(stack.size(), static_cast<int>(reference.size()));
+    }
+}
+
+// QueueUsingStacks Tests
+TEST(QueueUsingStacksTest, FIFOOrder) {
+    QueueUsingStacks<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.dequeue(), std::underflow_error);
+    EXPECT_THROW(queue.front(), std::underflow_error);
+
+    for (int i = 1; i <= 40; i++) {
+        queue.enqueue(i);
+    }
+    EXPECT_EQ(queue.front(), 1);
+    for (int i = 1; i <= 20; i++) {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    // Enqueue while the outbox still holds elements, forcing a grow
+    for (int i = 41; i <= 100; i++) {
+        queue.enqueue(i);
+    }
+    EXPECT_EQ(queue.size(), 80);
+    for (int i = 21; i <= 100; i++) {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(QueueUsingStacksTest, FullInboxTransfer) {
+    // Exactly fill the initial buffer with the outbox empty
+    QueueUsingStacks<std::string> queue;
+    for (int i = 0; i < 16; i++) {
+        queue.enqueue(std::to_string(i));
+    }
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(queue.dequeue(), std::to_string(i));
+    }
+}
+
+TEST(QueueUsingStacksTest, RandomizedAgainstStdQueue) {
+    QueueUsingStacks<int> queue;
+    std::queue<int> reference;
+    std::mt19937 rng(23);
+
+    for (int i = 0; i < 50000; i++) {
+        if (rng() % 5 < 3 || reference.empty()) {
+            int value = rng() % 100000;
+            queue.enqueue(value);
+            reference.push(value);
+        } else {
+            ASSERT_EQ(queue.front(), reference.front());
+            ASSERT_EQ(queue.dequeue(), reference.front());
+            reference.pop();
+        }
+        ASSERT_EQ(queue.size(), static_cast<int>(reference.size()));
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
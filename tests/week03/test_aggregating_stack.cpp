@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/applications.cpp"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// AggregatingStack Tests
+TEST(AggregatingStackTest, MinMaxSumGcd) {
+    AggregatingStack<int> minStack;
+    AggregatingStack<int, MaxAgg<int>> maxStack;
+    AggregatingStack<long long, SumAgg<long long>, false> sumStack;
+    AggregatingStack<int, GcdAgg<int>> gcdStack;
+
+    for (int value : {12, 18, 30, 6, 42}) {
+        minStack.push(value);
+        maxStack.push(value);
+        sumStack.push(value);
+        gcdStack.push(value);
+    }
+    EXPECT_EQ(minStack.aggregate(), 6);
+    EXPECT_EQ(maxStack.aggregate(), 42);
+    EXPECT_EQ(sumStack.aggregate(), 108);
+    EXPECT_EQ(gcdStack.aggregate(), 6);
+
+    minStack.pop();
+    minStack.pop();
+    maxStack.pop();
+    sumStack.pop();
+    gcdStack.pop();
+    gcdStack.pop();
+    EXPECT_EQ(minStack.aggregate(), 12);
+    EXPECT_EQ(maxStack.aggregate(), 30);
+    EXPECT_EQ(sumStack.aggregate(), 66);
+    EXPECT_EQ(gcdStack.aggregate(), 6);
+    EXPECT_EQ(minStack.top(), 30);
+}
+
+TEST(AggregatingStackTest, CompactModeStoresRunsOnlyOnChange) {
+    AggregatingStack<int> stack;
+    stack.push(5);
+    for (int i = 0; i < 1000; i++) {
+        stack.push(10 + i);
+    }
+    EXPECT_EQ(stack.aggregateRuns(), 1);
+    stack.push(3);
+    stack.push(3);
+    EXPECT_EQ(stack.aggregateRuns(), 2);
+    EXPECT_EQ(stack.aggregate(), 3);
+
+    stack.pop();
+    EXPECT_EQ(stack.aggregate(), 3);
+    stack.pop();
+    EXPECT_EQ(stack.aggregate(), 5);
+    EXPECT_EQ(stack.size(), 1001);
+}
+
+TEST(AggregatingStackTest, EmptyStackThrows) {
+    AggregatingStack<int> stack;
+    EXPECT_TRUE(stack.empty());
+    EXPECT_THROW(stack.pop(), std::underflow_error);
+    EXPECT_THROW(stack.top(), std::underflow_error);
+    EXPECT_THROW(stack.aggregate(), std::underflow_error);
+}
+
+TEST(AggregatingStackTest, RandomizedAgainstRecomputation) {
+    AggregatingStack<int> compact;
+    AggregatingStack<int, MinAgg<int>, false> plain;
+    std::vector<int> reference;
+    std::mt19937 rng(31);
+
+    for (int i = 0; i < 5000; i++) {
+        if (rng() % 3 != 0 || reference.empty()) {
+            int value = static_cast<int>(rng() % 200);
+            compact.push(value);
+            plain.push(value);
+            reference.push_back(value);
+        } else {
+            ASSERT_EQ(compact.pop(), reference.back());
+            ASSERT_EQ(plain.pop(), reference.back());
+            reference.pop_back();
+        }
+        if (!reference.empty()) {
+            int expected = *std::min_element(reference.begin(), reference.end());
+            ASSERT_EQ(compact.aggregate(), expected);
+            ASSERT_EQ(plain.aggregate(), expected);
+        }
+    }
+    EXPECT_LE(compact.aggregateRuns(), plain.aggregateRuns());
+}
+
+// Difference-Encoded MinStack / MaxStack Tests
+TEST(MinStackTest, ClassicSequence) {
+    MinStack stack;
+    stack.push(-2);
+    stack.push(0);
+    stack.push(-3);
+    EXPECT_EQ(stack.getMin(), -3);
+    stack.pop();
+    EXPECT_EQ(stack.top(), 0);
+    EXPECT_EQ(stack.getMin(), -2);
+
+    stack.pop();
+    stack.pop();
+    EXPECT_TRUE(stack.empty());
+    EXPECT_THROW(stack.pop(), std::underflow_error);
+    EXPECT_THROW(stack.getMin(), std::underflow_error);
+}
+
+TEST(MinStackTest, ExtremeValuesDoNotOverflow) {
+    MinStack minStack;
+    MaxStack maxStack;
+    for (int value : {INT_MAX, INT_MIN, 0, INT_MIN, INT_MAX}) {
+        minStack.push(value);
+        maxStack.push(value);
+    }
+    EXPECT_EQ(minStack.getMin(), INT_MIN);
+    EXPECT_EQ(maxStack.getMax(), INT_MAX);
+
+    std::vector<int> popped;
+    while (!minStack.empty()) {
+        popped.push_back(minStack.top());
+        minStack.pop();
+    }
+    EXPECT_EQ(popped, std::vector<int>({INT_MAX, INT_MIN, 0, INT_MIN, INT_MAX}));
+}
+
+TEST(MinStackTest, OnlyWideDifferencesSpill) {
+    DifferenceEncodedStack<std::less<long long>> narrow;
+    std::mt19937 rng(35);
+    for (int i = 0; i < 10000; i++) {
+        narrow.push(static_cast<int>(rng() % 2000000) - 1000000);
+    }
+    EXPECT_EQ(narrow.spilledDifferences(), 0);
+
+    DifferenceEncodedStack<std::less<long long>> wide;
+    wide.push(INT_MAX);
+    wide.push(INT_MIN);
+    wide.push(INT_MAX);
+    wide.push(-5);
+    EXPECT_EQ(wide.spilledDifferences(), 2);
+    EXPECT_EQ(wide.extreme(), INT_MIN);
+    EXPECT_EQ(wide.pop(), -5);
+    EXPECT_EQ(wide.pop(), INT_MAX);
+    EXPECT_EQ(wide.spilledDifferences(), 1);
+    EXPECT_EQ(wide.pop(), INT_MIN);
+    EXPECT_EQ(wide.extreme(), INT_MAX);
+    EXPECT_EQ(wide.spilledDifferences(), 0);
+}
+
+TEST(MinStackTest, RandomizedAgainstRecomputation) {
+    MinStack minStack;
+    MaxStack maxStack;
+    std::vector<int> reference;
+    std::mt19937 rng(37);
+
+    for (int i = 0; i < 5000; i++) {
+        if (rng() % 3 != 0 || reference.empty()) {
+            int value = static_cast<int>(rng());
+            minStack.push(value);
+            maxStack.push(value);
+            reference.push_back(value);
+        } else {
+            ASSERT_EQ(minStack.top(), reference.back());
+            ASSERT_EQ(maxStack.top(), reference.back());
+            minStack.pop();
+            maxStack.pop();
+            reference.pop_back();
+        }
+        if (!reference.empty()) {
+            ASSERT_EQ(minStack.getMin(), *std::min_element(reference.begin(), reference.end()));
+            ASSERT_EQ(maxStack.getMax(), *std::max_element(reference.begin(), reference.end()));
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/queue.cpp"
+#include "../../assignments/week03-stacks-queues/binary_labels.cpp"
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Packed Layout Tests
+TEST(PackedBinaryNumbersTest, SmallRange) {
+    PackedBinaryNumbers labels(10);
+    EXPECT_EQ(labels.size(), 10);
+    EXPECT_EQ(labels[0], "1");
+    EXPECT_EQ(labels[4], "101");
+    EXPECT_EQ(labels[9], "1010");
+    EXPECT_EQ(std::string(labels.data(), labels.bytes()), "11011100101110111100010011010");
+    EXPECT_THROW(labels.at(10), std::out_of_range);
+}
+
+TEST(PackedBinaryNumbersTest, EmptyForNonPositive) {
+    PackedBinaryNumbers none(0);
+    PackedBinaryNumbers negative(-3, 4);
+    EXPECT_EQ(none.size(), 0);
+    EXPECT_EQ(negative.size(), 0);
+    EXPECT_TRUE(none.begin() == none.end());
+}
+
+TEST(PackedBinaryNumbersTest, MatchesGenerateBinaryNumbers) {
+    const int N = 5000;
+    std::vector<std::string> expected = generateBinaryNumbers(N);
+    PackedBinaryNumbers labels(N);
+
+    int index = 0;
+    for (std::string_view label : labels) {
+        ASSERT_EQ(label, expected[index]) << "number " << index + 1;
+        index++;
+    }
+    EXPECT_EQ(index, N);
+}
+
+TEST(PackedBinaryNumbersTest, ClosedFormOffsets) {
+    EXPECT_EQ(PackedBinaryNumbers::offsetOf(1), 0u);
+    EXPECT_EQ(PackedBinaryNumbers::offsetOf(2), 1u);
+    EXPECT_EQ(PackedBinaryNumbers::offsetOf(4), 5u);
+    EXPECT_EQ(PackedBinaryNumbers::offsetOf(5), 8u);
+
+    size_t running = 0;
+    for (unsigned long long value = 1; value < 100000; value++) {
+        ASSERT_EQ(PackedBinaryNumbers::offsetOf(value), running);
+        running += 64 - __builtin_clzll(value);
+    }
+}
+
+TEST(PackedBinaryNumbersTest, ParallelMatchesSequential) {
+    const int N = 300001;
+    PackedBinaryNumbers sequential(N);
+    for (int threads : {2, 3, 8, 0}) {
+        PackedBinaryNumbers parallel(N, threads);
+        ASSERT_EQ(parallel.bytes(), sequential.bytes());
+        ASSERT_EQ(std::string_view(parallel.data(), parallel.bytes()),
+                  std::string_view(sequential.data(), sequential.bytes()));
+        ASSERT_EQ(parallel[N - 1], sequential[N - 1]);
+    }
+
+    // More threads than numbers
+    PackedBinaryNumbers tiny(3, 16);
+    EXPECT_EQ(tiny[2], "11");
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/stack.cpp"
+#include "../../assignments/week03-stacks-queues/bracket_checker.cpp"
+#include <random>
+#include <string>
+#include <vector>
+
+// Reference Position Tests
+TEST(FindUnbalancedPositionTest, ReportsFirstError) {
+    EXPECT_EQ(findUnbalancedPosition(""), -1);
+    EXPECT_EQ(findUnbalancedPosition("{[()]}"), -1);
+    EXPECT_EQ(findUnbalancedPosition("{[(])}"), 3);
+    EXPECT_EQ(findUnbalancedPosition("a)b"), 1);
+    EXPECT_EQ(findUnbalancedPosition("((x)"), 4);
+    EXPECT_TRUE(isBalanced("f(a[1], {b: 2})"));
+    EXPECT_FALSE(isBalanced("(]"));
+}
+
+// Chunked Checker Tests
+TEST(BracketCheckerTest, MatchesReferenceOnSmallCases) {
+    std::vector<std::string> cases = {
+        "", "()", "(", ")", "([)]", "{[()()]}", "]]", "((()", "abc", "{\"a\": [1, 2, {\"b\": (3)}]}",
+        "(((((((((((((((((((())))))))))))))))))))", "x(y[z{w}v]u)t)",
+    };
+    for (const std::string& expression : cases) {
+        for (int threads : {1, 2, 3, 7}) {
+            EXPECT_EQ(findUnbalancedPositionParallel(expression, threads), findUnbalancedPosition(expression))
+                << "'" << expression << "' with " << threads << " threads";
+        }
+    }
+}
+
+TEST(BracketCheckerTest, RandomizedAgainstReference) {
+    const std::string alphabet = "()[]{}ab \"";
+    std::mt19937 rng(2024);
+
+    for (int trial = 0; trial < 500; trial++) {
+        // Mostly well-formed nesting with occasional corruption
+        std::string expression;
+        std::string open;
+        int length = rng() % 300;
+        for (int i = 0; i < length; i++) {
+            int action = rng() % 10;
+            if (action < 3) {
+                char bracket = "([{"[rng() % 3];
+                expression += bracket;
+                open += bracket;
+            } else if (action < 6 && !open.empty()) {
+                char last = open.back();
+                open.pop_back();
+                expression += last == '(' ? ')' : last == '[' ? ']' : '}';
+            } else if (action == 6 && trial % 4 == 0) {
+                expression += alphabet[rng() % 6];
+            } else {
+                expression += alphabet[6 + rng() % 4];
+            }
+        }
+        if (trial % 2 == 0) {
+            while (!open.empty()) {
+                char last = open.back();
+                open.pop_back();
+                expression += last == '(' ? ')' : last == '[' ? ']' : '}';
+            }
+        }
+
+        long long expected = findUnbalancedPosition(expression);
+        for (int threads : {1, 4, 13}) {
+            ASSERT_EQ(findUnbalancedPositionParallel(expression, threads), expected)
+                << "trial " << trial << " with " << threads << " threads";
+        }
+    }
+}
+
+TEST(BracketCheckerTest, StreamingFeedAcrossPieceBoundaries) {
+    std::string expression = "{\"k\": [(1), (2), {\"v\": [3]}]}";
+    BracketChecker checker;
+    for (char ch : expression) {
+        checker.feed(std::string(1, ch));
+    }
+    EXPECT_EQ(checker.finish(), -1);
+
+    checker.clear();
+    checker.feed("[[{");
+    EXPECT_EQ(checker.depth(), 3);
+    checker.feed("}]");
+    EXPECT_EQ(checker.depth(), 1);
+    EXPECT_FALSE(checker.hasError());
+    EXPECT_EQ(checker.finish(), 5);
+    checker.feed(")]");
+    EXPECT_TRUE(checker.hasError());
+    EXPECT_EQ(checker.finish(), 5);
+}
+
+TEST(BracketCheckerTest, SingleBracketTypeUsesOneRun) {
+    const int DEPTH = 1 << 20;
+    std::string expression(DEPTH, '(');
+    expression += std::string(DEPTH, ')');
+
+    BracketChecker::ChunkSummary summary = BracketChecker::summarize(expression.data(), DEPTH);
+    ASSERT_EQ(summary.opens.size(), 1u);
+    EXPECT_EQ(summary.opens[0].count, DEPTH);
+
+    EXPECT_EQ(findUnbalancedPositionParallel(expression, 4), -1);
+    expression.push_back(')');
+    EXPECT_EQ(findUnbalancedPositionParallel(expression, 4), 2LL * DEPTH);
+    expression.insert(expression.begin(), '(');
+    EXPECT_EQ(findUnbalancedPositionParallel(expression, 4), -1);
+}
+
+TEST(BracketCheckerTest, LargePayloadParallel) {
+    std::string payload = "[";
+    for (int i = 0; i < 100000; i++) {
+        payload += "{\"id\": " + std::to_string(i) + ", \"tags\": [\"a\", \"b\"], \"f\": (x)},";
+    }
+    payload += "]";
+    ASSERT_GE(payload.size(), BracketChecker::PARALLEL_THRESHOLD);
+
+    EXPECT_EQ(findUnbalancedPositionParallel(payload), -1);
+    EXPECT_TRUE(isBalancedParallel(payload, 8));
+
+    size_t corrupt = payload.size() * 3 / 5;
+    while (payload[corrupt] != ']') {
+        corrupt++;
+    }
+    payload[corrupt] = '}';
+    EXPECT_EQ(findUnbalancedPositionParallel(payload, 8), findUnbalancedPosition(payload));
+    EXPECT_EQ(findUnbalancedPositionParallel(payload, 8), static_cast<long long>(corrupt));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/concurrent_queue.cpp"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+class MPMCQueueTest : public ::testing::Test {
+protected:
+    MPMCQueue<int> queue{8};
+};
+
+// Basic Operations Tests
+TEST_F(MPMCQueueTest, EmptyQueue) {
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_EQ(queue.getCapacity(), 8);
+
+    int value;
+    EXPECT_FALSE(queue.tryDequeue(value));
+}
+
+TEST_F(MPMCQueueTest, FIFOOrder) {
+    for (int i = 1; i <= 5; i++) {
+        EXPECT_TRUE(queue.tryEnqueue(i * 10));
+    }
+    EXPECT_EQ(queue.size(), 5);
+
+    for (int i = 1; i <= 5; i++) {
+        EXPECT_EQ(queue.dequeue(), i * 10);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(MPMCQueueTest, BoundedCapacity) {
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.tryEnqueue(i));
+    }
+    EXPECT_TRUE(queue.isFull());
+    EXPECT_FALSE(queue.tryEnqueue(99));
+
+    int value;
+    EXPECT_TRUE(queue.tryDequeue(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.tryEnqueue(99));
+}
+
+TEST_F(MPMCQueueTest, WrapAround) {
+    int value;
+    for (int lap = 0; lap < 10; lap++) {
+        for (int i = 0; i < 6; i++) {
+            queue.enqueue(lap * 100 + i);
+        }
+        for (int i = 0; i < 6; i++) {
+            ASSERT_TRUE(queue.tryDequeue(value));
+            EXPECT_EQ(value, lap * 100 + i);
+        }
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(MPMCQueueConstructionTest, CapacityRoundsUpToPowerOfTwo) {
+    MPMCQueue<int> queue(100);
+    EXPECT_EQ(queue.getCapacity(), 128);
+    EXPECT_THROW(MPMCQueue<int>(0), std::invalid_argument);
+    EXPECT_THROW(MPMCQueue<int>(-5), std::invalid_argument);
+}
+
+// Concurrency Tests
+TEST(MPMCQueueConcurrencyTest, ManyProducersManyConsumers) {
+    const int PRODUCERS = 4;
+    const int CONSUMERS = 4;
+    const int ITEMS_PER_PRODUCER = 20000;
+
+    MPMCQueue<int> queue(64);
+    std::atomic<long long> sum(0);
+    std::atomic<int> consumed(0);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 1; i <= ITEMS_PER_PRODUCER; i++) {
+                queue.enqueue(p * ITEMS_PER_PRODUCER + i);
+            }
+        });
+    }
+
+    for (int c = 0; c < CONSUMERS; c++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER / CONSUMERS; i++) {
+                sum += queue.dequeue();
+                consumed++;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    long long n = static_cast<long long>(PRODUCERS) * ITEMS_PER_PRODUCER;
+    EXPECT_EQ(consumed.load(), n);
+    EXPECT_EQ(sum.load(), n * (n + 1) / 2);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(MPMCQueueConcurrencyTest, PerProducerOrderPreserved) {
+    const int PRODUCERS = 3;
+    const int ITEMS_PER_PRODUCER = 10000;
+
+    MPMCQueue<int> queue(16);
+    std::vector<std::thread> producers;
+
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+                queue.enqueue(p * ITEMS_PER_PRODUCER + i);
+            }
+        });
+    }
+
+    // Single consumer must see every producer's items in increasing order
+    std::vector<int> lastSeen(PRODUCERS, -1);
+    for (int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER; i++) {
+        int value = queue.dequeue();
+        int producer = value / ITEMS_PER_PRODUCER;
+        EXPECT_GT(value, lastSeen[producer]);
+        lastSeen[producer] = value;
+    }
+
+    for (std::thread& thread : producers) {
+        thread.join();
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
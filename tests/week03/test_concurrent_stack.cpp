@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/concurrent_stack.cpp"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+
+class LockFreeStackTest : public ::testing::Test {
+protected:
+    LockFreeStack<int> stack;
+};
+
+// Basic Operations Tests
+TEST_F(LockFreeStackTest, EmptyStack) {
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_EQ(stack.size(), 0);
+    EXPECT_THROW(stack.pop(), std::underflow_error);
+    EXPECT_THROW(stack.peek(), std::underflow_error);
+
+    int value;
+    EXPECT_FALSE(stack.tryPop(value));
+}
+
+TEST_F(LockFreeStackTest, LIFOOrder) {
+    stack.push(10);
+    stack.push(20);
+    stack.push(30);
+
+    EXPECT_EQ(stack.size(), 3);
+    EXPECT_EQ(stack.peek(), 30);
+    EXPECT_EQ(stack.pop(), 30);
+    EXPECT_EQ(stack.pop(), 20);
+    EXPECT_EQ(stack.pop(), 10);
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+TEST_F(LockFreeStackTest, PushBatchMatchesSequentialPushes) {
+    stack.push(1);
+    std::vector<int> batch = {2, 3, 4, 5};
+    stack.pushBatch(batch.begin(), batch.end());
+
+    EXPECT_EQ(stack.size(), 5);
+    for (int expected = 5; expected >= 1; expected--) {
+        EXPECT_EQ(stack.pop(), expected);
+    }
+
+    std::vector<int> empty;
+    stack.pushBatch(empty.begin(), empty.end());
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+TEST_F(LockFreeStackTest, NodesAreRecycledAcrossPoolChunks) {
+    // Grow past several pool chunks, drain, and refill
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 5000; i++) {
+            stack.push(i);
+        }
+        for (int i = 4999; i >= 0; i--) {
+            ASSERT_EQ(stack.pop(), i);
+        }
+    }
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+TEST(LockFreeStackTemplateTest, StringStack) {
+    LockFreeStack<std::string> stack;
+    stack.push("hello");
+    stack.push("world");
+    EXPECT_EQ(stack.peek(), "world");
+    EXPECT_EQ(stack.pop(), "world");
+    EXPECT_EQ(stack.pop(), "hello");
+}
+
+// Concurrency Tests
+TEST(LockFreeStackConcurrencyTest, ConcurrentPushThenPop) {
+    const int THREADS = 4;
+    const int ITEMS_PER_THREAD = 20000;
+
+    LockFreeStack<int> stack;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&stack, t]() {
+            for (int i = 0; i < ITEMS_PER_THREAD; i++) {
+                stack.push(t * ITEMS_PER_THREAD + i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(stack.size(), THREADS * ITEMS_PER_THREAD);
+
+    std::vector<int> popped;
+    int value;
+    while (stack.tryPop(value)) {
+        popped.push_back(value);
+    }
+    std::sort(popped.begin(), popped.end());
+    ASSERT_EQ(popped.size(), static_cast<size_t>(THREADS * ITEMS_PER_THREAD));
+    for (int i = 0; i < THREADS * ITEMS_PER_THREAD; i++) {
+        EXPECT_EQ(popped[i], i);
+    }
+}
+
+TEST(LockFreeStackConcurrencyTest, MixedPushPopPreservesElements) {
+    const int THREADS = 8;
+    const int OPERATIONS = 20000;
+
+    LockFreeStack<int> stack;
+    std::atomic<long long> pushedSum(0);
+    std::atomic<long long> poppedSum(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t]() {
+            int value;
+            for (int i = 1; i <= OPERATIONS; i++) {
+                if (i % 3 == 0) {
+                    int batch[3] = {i, i + 1, i + 2};
+                    stack.pushBatch(batch, batch + 3);
+                    pushedSum += 3LL * i + 3;
+                } else if (i % 2 == 0 || t % 2 == 0) {
+                    stack.push(i);
+                    pushedSum += i;
+                } else if (stack.tryPop(value)) {
+                    poppedSum += value;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    int value;
+    while (stack.tryPop(value)) {
+        poppedSum += value;
+    }
+    EXPECT_EQ(pushedSum.load(), poppedSum.load());
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/expression_engine.cpp"
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <limits>
+
+// Compilation and Evaluation Tests
+TEST(ExpressionProgramTest, OperatorPrecedence) {
+    EXPECT_EQ(ExpressionProgram::compile("3 + 5 * 2 - 1").evaluate(), 12);
+    EXPECT_EQ(ExpressionProgram::compile("(3 + 5) * 2").evaluate(), 16);
+    EXPECT_EQ(ExpressionProgram::compile("20 / 3 % 4").evaluate(), 2);
+    EXPECT_EQ(ExpressionProgram::compile("((2))").evaluate(), 2);
+}
+
+TEST(ExpressionProgramTest, MultiDigitLiterals) {
+    EXPECT_EQ(ExpressionProgram::compile("123 + 4567").evaluate(), 4690);
+    EXPECT_EQ(ExpressionProgram::compile("1000000 * 1000000").evaluate(), 1000000000000LL);
+}
+
+TEST(ExpressionProgramTest, PowerAndUnaryMinus) {
+    EXPECT_EQ(ExpressionProgram::compile("2 ^ 10").evaluate(), 1024);
+    EXPECT_EQ(ExpressionProgram::compile("2 ^ 3 ^ 2").evaluate(), 512);  // right associative
+    EXPECT_EQ(ExpressionProgram::compile("-2 ^ 2").evaluate(), -4);
+    EXPECT_EQ(ExpressionProgram::compile("(-2) ^ 3").evaluate(), -8);
+    EXPECT_EQ(ExpressionProgram::compile("3 ^ 0").evaluate(), 1);
+    EXPECT_EQ(ExpressionProgram::compile("5 * -3").evaluate(), -15);
+    EXPECT_EQ(ExpressionProgram::compile("--4").evaluate(), 4);
+    EXPECT_EQ(ExpressionProgram::compile("+7").evaluate(), 7);
+    EXPECT_THROW(ExpressionProgram::compile("2 ^ -1").evaluate(), std::invalid_argument);
+}
+
+TEST(ExpressionProgramTest, VariablesAreBoundByPosition) {
+    ExpressionProgram program = ExpressionProgram::compile("price * qty - discount", {"price", "qty", "discount"});
+
+    EXPECT_EQ(program.evaluate({10, 3, 5}), 25);
+    EXPECT_EQ(program.evaluate({7, 7, 0}), 49);
+    EXPECT_THROW(program.evaluate({1, 2}), std::invalid_argument);
+
+    long long bindings[] = {2, 50, 1};
+    EXPECT_EQ(program.evaluate(bindings), 99);
+}
+
+TEST(ExpressionProgramTest, CompiledFormIsPostfix) {
+    ExpressionProgram program = ExpressionProgram::compile("a + b * c - 42", {"a", "b", "c"});
+    EXPECT_EQ(program.toPostfix(), "a b c * + 42 -");
+    EXPECT_EQ(program.length(), 7);
+    EXPECT_EQ(program.stackDepth(), 3);
+}
+
+// Error Handling Tests
+TEST(ExpressionProgramTest, SyntaxErrors) {
+    EXPECT_THROW(ExpressionProgram::compile("(1 + 2"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("1 + 2)"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("1 +"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("* 2"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("1 2"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile(""), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("x + 1"), std::invalid_argument);
+    EXPECT_THROW(ExpressionProgram::compile("3 $ 4"), std::invalid_argument);
+}
+
+TEST(ExpressionProgramTest, RuntimeErrors) {
+    ExpressionProgram divide = ExpressionProgram::compile("a / b", {"a", "b"});
+    EXPECT_THROW(divide.evaluate({1, 0}), std::runtime_error);
+
+    ExpressionProgram modulo = ExpressionProgram::compile("a % b", {"a", "b"});
+    EXPECT_THROW(modulo.evaluate({1, 0}), std::runtime_error);
+}
+
+TEST(ExpressionProgramTest, OverflowThrowsInsteadOfTrapping) {
+    const long long MIN = std::numeric_limits<long long>::min();
+    const long long MAX = std::numeric_limits<long long>::max();
+    ExpressionProgram divide = ExpressionProgram::compile("a / b", {"a", "b"});
+    EXPECT_THROW(divide.evaluate({MIN, -1}), std::overflow_error);
+    EXPECT_EQ(divide.evaluate({MIN, 1}), MIN);
+    EXPECT_EQ(ExpressionProgram::compile("a % b", {"a", "b"}).evaluate({MIN, -1}), 0);
+
+    EXPECT_THROW(ExpressionProgram::compile("a + 1", {"a"}).evaluate({MAX}), std::overflow_error);
+    EXPECT_THROW(ExpressionProgram::compile("a - 1", {"a"}).evaluate({MIN}), std::overflow_error);
+    EXPECT_THROW(ExpressionProgram::compile("a * 2", {"a"}).evaluate({MAX / 2 + 1}), std::overflow_error);
+    EXPECT_THROW(ExpressionProgram::compile("-a", {"a"}).evaluate({MIN}), std::overflow_error);
+    EXPECT_THROW(ExpressionProgram::compile("2 ^ 63").evaluate(), std::overflow_error);
+    EXPECT_EQ(ExpressionProgram::compile("2 ^ 62").evaluate(), 1LL << 62);
+    EXPECT_EQ(ExpressionProgram::compile("(0 - 1) ^ 1000000").evaluate(), 1);
+    EXPECT_THROW(ExpressionProgram::compile("99999999999999999999"), std::overflow_error);
+
+    ExpressionProgram sum = ExpressionProgram::compile("a + b", {"a", "b"});
+    EXPECT_THROW(sum.evaluateBatch({{1, MAX}, {1, 1}}), std::overflow_error);
+    EXPECT_THROW(divide.evaluateBatch({{4, MIN}, {2, -1}}), std::overflow_error);
+    EXPECT_EQ(sum.evaluateBatch({{1, MAX - 1}, {1, 1}}), std::vector<long long>({2, MAX}));
+}
+
+TEST(ExpressionProgramTest, StackDepthLimit) {
+    // Right-nested sums need one stack slot per operand
+    std::string deep = "1";
+    for (int i = 0; i < 100; i++) {
+        deep = "1 + (" + deep + ")";
+    }
+    EXPECT_THROW(ExpressionProgram::compile(deep), std::invalid_argument);
+
+    // Left-nested sums stay shallow regardless of length
+    std::string wide = "1";
+    for (int i = 0; i < 100; i++) {
+        wide += " + 1";
+    }
+    EXPECT_EQ(ExpressionProgram::compile(wide).evaluate(), 101);
+}
+
+// Batch Evaluation Tests
+TEST(ExpressionProgramTest, BatchMatchesSingleEvaluation) {
+    ExpressionProgram program = ExpressionProgram::compile("(x - y) ^ 2 + x * 3 % 7 - -y", {"x", "y"});
+
+    std::vector<long long> xs;
+    std::vector<long long> ys;
+    for (int i = 0; i < 1000; i++) {
+        xs.push_back(i * 7 - 300);
+        ys.push_back(i % 13);
+    }
+
+    std::vector<long long> results = program.evaluateBatch({xs, ys});
+    ASSERT_EQ(results.size(), xs.size());
+    for (size_t i = 0; i < xs.size(); i++) {
+        ASSERT_EQ(results[i], program.evaluate({xs[i], ys[i]})) << "row " << i;
+    }
+}
+
+TEST(ExpressionProgramTest, BatchErrors) {
+    ExpressionProgram program = ExpressionProgram::compile("a / b", {"a", "b"});
+    EXPECT_THROW(program.evaluateBatch({{1, 2}}), std::invalid_argument);
+    EXPECT_THROW(program.evaluateBatch({{1, 2}, {1}}), std::invalid_argument);
+    EXPECT_THROW(program.evaluateBatch({{1, 2}, {1, 0}}), std::runtime_error);
+
+    ExpressionProgram constant = ExpressionProgram::compile("6 * 7");
+    EXPECT_EQ(constant.evaluateBatch({}), std::vector<long long>({42}));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
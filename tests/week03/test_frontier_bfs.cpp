@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/frontier_bfs.cpp"
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Reference: plain queue BFS grouped by distance, each level sorted
+std::vector<std::vector<int>> referenceLevels(const std::vector<std::vector<int>>& graph, int start) {
+    std::vector<int> distance(graph.size(), -1);
+    std::queue<int> queue;
+    std::vector<std::vector<int>> levels;
+    distance[start] = 0;
+    queue.push(start);
+    while (!queue.empty()) {
+        int vertex = queue.front();
+        queue.pop();
+        if (distance[vertex] == static_cast<int>(levels.size())) {
+            levels.emplace_back();
+        }
+        levels[distance[vertex]].push_back(vertex);
+        for (int neighbor : graph[vertex]) {
+            if (distance[neighbor] == -1) {
+                distance[neighbor] = distance[vertex] + 1;
+                queue.push(neighbor);
+            }
+        }
+    }
+    for (std::vector<int>& level : levels) {
+        std::sort(level.begin(), level.end());
+    }
+    return levels;
+}
+
+std::vector<std::vector<int>> sortedLevels(std::vector<std::vector<int>> levels) {
+    for (std::vector<int>& level : levels) {
+        std::sort(level.begin(), level.end());
+    }
+    return levels;
+}
+
+// CSR Construction Tests
+TEST(CSRGraphTest, EdgeListAndTranspose) {
+    CSRGraph graph(4, {{0, 1}, {0, 2}, {2, 3}, {1, 3}, {3, 0}});
+    EXPECT_EQ(graph.vertexCount(), 4);
+    EXPECT_EQ(graph.edgeCount(), 5);
+    EXPECT_EQ(graph.degree(0), 2);
+    EXPECT_EQ(graph.offsets, std::vector<int>({0, 2, 3, 4, 5}));
+
+    CSRGraph reversed = graph.transpose();
+    EXPECT_EQ(reversed.degree(3), 2);
+    EXPECT_EQ(reversed.degree(0), 1);
+    EXPECT_EQ(reversed.targets[reversed.offsets[0]], 3);
+
+    EXPECT_THROW(CSRGraph(2, {{0, 2}}), std::invalid_argument);
+    EXPECT_THROW(CSRGraph::fromAdjacencyList({{1}, {5}}), std::invalid_argument);
+}
+
+// Traversal Tests
+TEST(LevelOrderFrontiersTest, SmallUndirectedGraph) {
+    std::vector<std::vector<int>> adjacency = {{1, 2}, {0, 3}, {0, 3}, {1, 2, 4}, {3}, {}};
+    CSRGraph graph = CSRGraph::fromAdjacencyList(adjacency);
+
+    std::vector<std::vector<int>> expected = {{0}, {1, 2}, {3}, {4}};
+    for (BFSDirection direction : {BFSDirection::AUTO, BFSDirection::TOP_DOWN, BFSDirection::BOTTOM_UP}) {
+        EXPECT_EQ(sortedLevels(levelOrderFrontiers(graph, 0, &graph, direction)), expected);
+    }
+    // Top-down keeps queue discovery order
+    EXPECT_EQ(levelOrderFrontiers(graph, 3, &graph, BFSDirection::TOP_DOWN),
+              std::vector<std::vector<int>>({{3}, {1, 2, 4}, {0}}));
+
+    EXPECT_THROW(levelOrderFrontiers(graph, 6), std::invalid_argument);
+    EXPECT_THROW(levelOrderFrontiers(graph, -1), std::invalid_argument);
+}
+
+TEST(LevelOrderFrontiersTest, RandomDirectedGraphsAllDirections) {
+    std::mt19937 rng(77);
+    for (int trial = 0; trial < 20; trial++) {
+        int n = 50 + static_cast<int>(rng() % 500);
+        int m = n * (1 + static_cast<int>(rng() % 12));
+        std::vector<std::vector<int>> adjacency(n);
+        std::vector<std::pair<int, int>> edges;
+        for (int i = 0; i < m; i++) {
+            int u = static_cast<int>(rng() % n);
+            int v = static_cast<int>(rng() % n);
+            adjacency[u].push_back(v);
+            edges.push_back({u, v});
+        }
+        CSRGraph graph(n, edges);
+        CSRGraph reversed = graph.transpose();
+        int start = static_cast<int>(rng() % n);
+
+        std::vector<std::vector<int>> expected = referenceLevels(adjacency, start);
+        ASSERT_EQ(sortedLevels(levelOrderFrontiers(graph, start)), expected) << "trial " << trial;
+        ASSERT_EQ(sortedLevels(levelOrderFrontiers(graph, start, &reversed, BFSDirection::TOP_DOWN)), expected);
+        ASSERT_EQ(sortedLevels(levelOrderFrontiers(graph, start, &reversed, BFSDirection::BOTTOM_UP)), expected);
+        ASSERT_EQ(sortedLevels(levelOrderFrontiers(graph, start, nullptr, BFSDirection::BOTTOM_UP)), expected);
+    }
+}
+
+TEST(LevelOrderFrontiersTest, DenseGraphSwitchesDirection) {
+    // Dense random undirected graph: AUTO must take bottom-up steps and still agree
+    std::mt19937 rng(5);
+    const int N = 20000;
+    std::vector<std::vector<int>> adjacency(N);
+    for (int i = 0; i < N * 16; i++) {
+        int u = static_cast<int>(rng() % N);
+        int v = static_cast<int>(rng() % N);
+        adjacency[u].push_back(v);
+        adjacency[v].push_back(u);
+    }
+    CSRGraph graph = CSRGraph::fromAdjacencyList(adjacency);
+    EXPECT_EQ(sortedLevels(levelOrderFrontiers(graph, 0, &graph)), referenceLevels(adjacency, 0));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/queue.cpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// Survivor Tests
+TEST(JosephusTest, KnownValues) {
+    EXPECT_EQ(josephusProblem(7, 3), 4);
+    EXPECT_EQ(josephusProblem(1, 5), 1);
+    EXPECT_EQ(josephusProblem(5, 2), 3);
+    EXPECT_EQ(josephusProblem(41, 3), 31);
+    EXPECT_EQ(josephusSurvivor(6, 1), 6);
+}
+
+TEST(JosephusTest, SolversAgreeWithSimulation) {
+    for (int n = 1; n <= 120; n++) {
+        for (int k = 1; k <= 25; k++) {
+            int expected = josephusSimulation(n, k);
+            ASSERT_EQ(josephusLinear(n, k), expected) << "n=" << n << " k=" << k;
+            ASSERT_EQ(josephusLogarithmic(n, k), expected) << "n=" << n << " k=" << k;
+            ASSERT_EQ(josephusSurvivor(n, k), expected) << "n=" << n << " k=" << k;
+        }
+    }
+}
+
+TEST(JosephusTest, LargeCirclesAgree) {
+    // Tens of millions of people: the logarithmic solver must match the recurrence
+    for (long long k : {2LL, 3LL, 17LL, 1000LL}) {
+        EXPECT_EQ(josephusLogarithmic(20000000, k), josephusLinear(20000000, k)) << "k=" << k;
+    }
+    EXPECT_EQ(josephusSurvivor(1LL << 40, 2), 1);  // power of two, k = 2
+}
+
+TEST(JosephusTest, InvalidArguments) {
+    EXPECT_THROW(josephusProblem(0, 3), std::invalid_argument);
+    EXPECT_THROW(josephusSurvivor(5, 0), std::invalid_argument);
+    EXPECT_THROW(josephusEliminationOrder(-1, 2), std::invalid_argument);
+}
+
+// Elimination Order Tests
+TEST(JosephusEliminationOrderTest, ClassicExample) {
+    EXPECT_EQ(josephusEliminationOrder(7, 3), std::vector<int>({3, 6, 2, 7, 5, 1, 4}));
+    EXPECT_EQ(josephusEliminationOrder(1, 9), std::vector<int>({1}));
+    EXPECT_EQ(josephusEliminationOrder(4, 1), std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(JosephusEliminationOrderTest, MatchesQueueSimulation) {
+    for (int n = 1; n <= 60; n++) {
+        for (int k = 1; k <= 12; k++) {
+            // Reference: replay the queue simulation and record the victims
+            Queue<int> queue;
+            for (int i = 1; i <= n; i++) {
+                queue.enqueue(i);
+            }
+            std::vector<int> expected;
+            while (!queue.isEmpty()) {
+                for (int i = 0; i < k - 1; i++) {
+                    queue.enqueue(queue.dequeue());
+                }
+                expected.push_back(queue.dequeue());
+            }
+            ASSERT_EQ(josephusEliminationOrder(n, k), expected) << "n=" << n << " k=" << k;
+        }
+    }
+}
+
+TEST(JosephusEliminationOrderTest, LastEliminatedIsSurvivor) {
+    std::vector<int> order = josephusEliminationOrder(100000, 7);
+    EXPECT_EQ(order.back(), josephusSurvivor(100000, 7));
+
+    std::vector<int> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < 100000; i++) {
+        ASSERT_EQ(sorted[i], i + 1);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
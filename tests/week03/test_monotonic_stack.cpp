@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/applications.cpp"
+#include "../../assignments/week03-stacks-queues/monotonic_stack.cpp"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+std::vector<int> randomValues(std::mt19937& rng, int n, int range) {
+    std::vector<int> values(n);
+    for (int& value : values) {
+        value = static_cast<int>(rng() % range);
+    }
+    return values;
+}
+
+// Nearest Element Tests
+TEST(MonotonicStackEngineTest, NearestGreaterAndSmaller) {
+    std::vector<int> values = {4, 5, 2, 25, 2, 7};
+    std::vector<int> next(values.size());
+    std::vector<int> previous(values.size());
+    MonotonicStackEngine engine;
+
+    engine.nearestGreater(values.data(), 6, next.data(), previous.data());
+    EXPECT_EQ(next, std::vector<int>({1, 3, 3, -1, 5, -1}));
+    EXPECT_EQ(previous, std::vector<int>({-1, -1, 1, -1, 3, 3}));
+
+    engine.nearestSmaller(values.data(), 6, next.data(), previous.data());
+    EXPECT_EQ(next, std::vector<int>({2, 2, -1, 4, -1, -1}));
+    EXPECT_EQ(previous, std::vector<int>({-1, 0, -1, 2, 2, 4}));
+}
+
+TEST(MonotonicStackEngineTest, RandomizedAgainstBruteForce) {
+    std::mt19937 rng(91);
+    MonotonicStackEngine engine;
+    for (int trial = 0; trial < 200; trial++) {
+        std::vector<int> values = randomValues(rng, 1 + rng() % 60, 10);
+        int n = static_cast<int>(values.size());
+        std::vector<int> nextGreater(n), previousGreater(n), nextSmaller(n), previousSmaller(n);
+        engine.nearestGreater(values.data(), n, nextGreater.data(), previousGreater.data());
+        engine.nearestSmaller(values.data(), n, nextSmaller.data(), previousSmaller.data());
+
+        for (int i = 0; i < n; i++) {
+            int expectedNextGreater = -1, expectedNextSmaller = -1;
+            int expectedPreviousGreater = -1, expectedPreviousSmaller = -1;
+            for (int j = i + 1; j < n && expectedNextGreater == -1; j++) {
+                if (values[j] > values[i]) expectedNextGreater = j;
+            }
+            for (int j = i + 1; j < n && expectedNextSmaller == -1; j++) {
+                if (values[j] < values[i]) expectedNextSmaller = j;
+            }
+            for (int j = i - 1; j >= 0 && expectedPreviousGreater == -1; j--) {
+                if (values[j] >= values[i]) expectedPreviousGreater = j;
+            }
+            for (int j = i - 1; j >= 0 && expectedPreviousSmaller == -1; j--) {
+                if (values[j] <= values[i]) expectedPreviousSmaller = j;
+            }
+            ASSERT_EQ(nextGreater[i], expectedNextGreater);
+            ASSERT_EQ(previousGreater[i], expectedPreviousGreater);
+            ASSERT_EQ(nextSmaller[i], expectedNextSmaller);
+            ASSERT_EQ(previousSmaller[i], expectedPreviousSmaller);
+        }
+        ASSERT_EQ(nextGreaterBatch({values}, 1)[0], nextGreaterElement(values));
+    }
+}
+
+// Rectangle Tests
+TEST(MonotonicStackEngineTest, LargestRectangleMatchesOriginal) {
+    std::mt19937 rng(13);
+    MonotonicStackEngine engine;
+    EXPECT_EQ(engine.largestRectangle(nullptr, 0), 0);
+    std::vector<int> classic = {2, 1, 5, 6, 2, 3};
+    EXPECT_EQ(engine.largestRectangle(classic.data(), 6), 10);
+
+    for (int trial = 0; trial < 200; trial++) {
+        std::vector<int> heights = randomValues(rng, 1 + rng() % 200, 50);
+        EXPECT_EQ(engine.largestRectangle(heights.data(), static_cast<int>(heights.size())),
+                  largestRectangleArea(heights));
+    }
+}
+
+TEST(MonotonicStackEngineTest, CallerProvidedScratch) {
+    std::vector<int> heights = {3, 3, 3, 3};
+    int scratch[5];
+    MonotonicStackEngine engine(scratch, 5);
+    EXPECT_EQ(engine.largestRectangle(heights.data(), 4), 12);
+
+    std::vector<int> tooLong(5, 1);
+    EXPECT_THROW(engine.largestRectangle(tooLong.data(), 5), std::invalid_argument);
+    EXPECT_THROW(MonotonicStackEngine(nullptr, 4), std::invalid_argument);
+}
+
+TEST(MonotonicStackEngineTest, MaximalRectangle) {
+    MonotonicStackEngine engine;
+    std::vector<std::vector<int>> matrix = {
+        {1, 0, 1, 0, 0},
+        {1, 0, 1, 1, 1},
+        {1, 1, 1, 1, 1},
+        {1, 0, 0, 1, 0},
+    };
+    EXPECT_EQ(engine.maximalRectangle(matrix), 6);
+    EXPECT_EQ(engine.maximalRectangle(std::vector<std::vector<int>>()), 0);
+    EXPECT_EQ(engine.maximalRectangle({{0, 0}, {0, 0}}), 0);
+    EXPECT_THROW(engine.maximalRectangle({{1, 1}, {1}}), std::invalid_argument);
+
+    // Brute force over all rectangles on random matrices
+    std::mt19937 rng(4);
+    for (int trial = 0; trial < 50; trial++) {
+        int rows = 1 + rng() % 8;
+        int cols = 1 + rng() % 8;
+        std::vector<std::vector<int>> grid(rows, std::vector<int>(cols));
+        for (auto& row : grid) {
+            for (int& cell : row) {
+                cell = rng() % 4 != 0;
+            }
+        }
+        long long best = 0;
+        for (int r1 = 0; r1 < rows; r1++)
+            for (int c1 = 0; c1 < cols; c1++)
+                for (int r2 = r1; r2 < rows; r2++)
+                    for (int c2 = c1; c2 < cols; c2++) {
+                        bool full = true;
+                        for (int r = r1; r <= r2 && full; r++)
+                            for (int c = c1; c <= c2 && full; c++)
+                                full = grid[r][c] == 1;
+                        if (full) best = std::max(best, 1LL * (r2 - r1 + 1) * (c2 - c1 + 1));
+                    }
+        ASSERT_EQ(engine.maximalRectangle(grid), best) << "trial " << trial;
+    }
+}
+
+// Batch Tests
+TEST(MonotonicBatchTest, ParallelMatchesSequential) {
+    std::mt19937 rng(55);
+    std::vector<std::vector<int>> histograms;
+    for (int i = 0; i < 500; i++) {
+        histograms.push_back(randomValues(rng, rng() % 300, 1000));
+    }
+
+    std::vector<long long> areas = largestRectangleBatch(histograms, 4);
+    std::vector<std::vector<int>> nextGreater = nextGreaterBatch(histograms, 3);
+    ASSERT_EQ(areas.size(), histograms.size());
+    for (size_t i = 0; i < histograms.size(); i++) {
+        ASSERT_EQ(areas[i], largestRectangleArea(histograms[i]));
+        ASSERT_EQ(nextGreater[i], nextGreaterElement(histograms[i]));
+    }
+    EXPECT_TRUE(largestRectangleBatch({}, 4).empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/queue.cpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+// d-ary PriorityQueue Tests
+TEST(PriorityQueueTest, MaxHeapByDefault) {
+    PriorityQueue<int> pq;
+    for (int value : {10, 30, 20, 40, 5, 25}) {
+        pq.enqueue(value);
+    }
+
+    EXPECT_EQ(pq.size(), 6);
+    EXPECT_EQ(pq.top(), 40);
+
+    std::vector<int> order;
+    while (!pq.isEmpty()) {
+        order.push_back(pq.dequeue());
+    }
+    EXPECT_EQ(order, std::vector<int>({40, 30, 25, 20, 10, 5}));
+    EXPECT_THROW(pq.dequeue(), std::underflow_error);
+    EXPECT_THROW(pq.top(), std::underflow_error);
+}
+
+TEST(PriorityQueueTest, MinHeapWithComparator) {
+    PriorityQueue<int, 4, std::greater<int>> pq;
+    for (int value : {10, 30, 20, 40, 5, 25}) {
+        pq.enqueue(value);
+    }
+
+    std::vector<int> order;
+    while (!pq.isEmpty()) {
+        order.push_back(pq.dequeue());
+    }
+    EXPECT_EQ(order, std::vector<int>({5, 10, 20, 25, 30, 40}));
+}
+
+TEST(PriorityQueueTest, BuildHeapFromRange) {
+    std::vector<int> values(1000);
+    std::mt19937 rng(42);
+    for (int& value : values) {
+        value = rng() % 10000;
+    }
+
+    PriorityQueue<int> pq(values.begin(), values.end());
+    EXPECT_EQ(pq.size(), 1000);
+
+    std::sort(values.rbegin(), values.rend());
+    for (int expected : values) {
+        ASSERT_EQ(pq.dequeue(), expected);
+    }
+
+    // buildHeap replaces existing contents
+    pq.enqueue(99);
+    std::vector<int> small = {3, 1, 2};
+    pq.buildHeap(small.begin(), small.end());
+    EXPECT_EQ(pq.size(), 3);
+    EXPECT_EQ(pq.top(), 3);
+}
+
+TEST(PriorityQueueTest, BinaryAndEightAryAgree) {
+    PriorityQueue<int, 2> binary;
+    PriorityQueue<int, 8> eightAry;
+    std::mt19937 rng(7);
+
+    for (int i = 0; i < 5000; i++) {
+        int value = rng() % 1000;
+        if (i % 3 == 2 && !binary.isEmpty()) {
+            ASSERT_EQ(binary.dequeue(), eightAry.dequeue());
+        } else {
+            binary.enqueue(value);
+            eightAry.enqueue(value);
+        }
+    }
+    while (!binary.isEmpty()) {
+        ASSERT_EQ(binary.dequeue(), eightAry.dequeue());
+    }
+    EXPECT_TRUE(eightAry.isEmpty());
+}
+
+// IndexedPriorityQueue Tests
+TEST(IndexedPriorityQueueTest, HandlesTrackElements) {
+    IndexedPriorityQueue<int> pq;
+    auto a = pq.enqueue(10);
+    auto b = pq.enqueue(20);
+    auto c = pq.enqueue(30);
+
+    EXPECT_EQ(pq.top(), 30);
+    EXPECT_EQ(pq.topHandle(), c);
+    EXPECT_EQ(pq.key(a), 10);
+
+    pq.increaseKey(a, 50);
+    EXPECT_EQ(pq.topHandle(), a);
+
+    pq.decreaseKey(a, 1);
+    EXPECT_EQ(pq.topHandle(), c);
+
+    pq.erase(c);
+    EXPECT_FALSE(pq.contains(c));
+    EXPECT_EQ(pq.size(), 2);
+    EXPECT_EQ(pq.dequeue(), 20);
+    EXPECT_EQ(pq.dequeue(), 1);
+    EXPECT_FALSE(pq.contains(b));
+    EXPECT_TRUE(pq.isEmpty());
+}
+
+TEST(IndexedPriorityQueueTest, InvalidHandles) {
+    IndexedPriorityQueue<int> pq;
+    auto handle = pq.enqueue(5);
+    pq.dequeue();
+
+    EXPECT_THROW(pq.erase(handle), std::invalid_argument);
+    EXPECT_THROW(pq.key(-1), std::invalid_argument);
+    EXPECT_THROW(pq.update(42, 1), std::invalid_argument);
+    EXPECT_THROW(pq.topHandle(), std::underflow_error);
+
+    auto live = pq.enqueue(10);
+    EXPECT_THROW(pq.decreaseKey(live, 11), std::invalid_argument);
+    EXPECT_THROW(pq.increaseKey(live, 9), std::invalid_argument);
+    EXPECT_EQ(pq.key(live), 10);
+    pq.decreaseKey(live, 10);
+}
+
+TEST(IndexedPriorityQueueTest, DijkstraStyleMinHeap) {
+    // Small weighted graph: shortest distances from vertex 0
+    std::vector<std::vector<std::pair<int, int>>> graph = {
+        {{1, 4}, {2, 1}},
+        {{3, 1}},
+        {{1, 2}, {3, 5}},
+        {{4, 3}},
+        {},
+    };
+    const int INF = 1 << 30;
+    std::vector<int> dist(graph.size(), INF);
+
+    IndexedPriorityQueue<std::pair<int, int>, 4, std::greater<std::pair<int, int>>> pq;
+    std::vector<int> handle(graph.size(), -1);
+    dist[0] = 0;
+    handle[0] = pq.enqueue({0, 0});
+
+    while (!pq.isEmpty()) {
+        auto [d, u] = pq.dequeue();
+        handle[u] = -1;
+        for (auto [v, w] : graph[u]) {
+            if (d + w < dist[v]) {
+                dist[v] = d + w;
+                if (handle[v] != -1 && pq.contains(handle[v])) {
+                    pq.decreaseKey(handle[v], {dist[v], v});
+                } else {
+                    handle[v] = pq.enqueue({dist[v], v});
+                }
+            }
+        }
+    }
+
+    EXPECT_EQ(dist, std::vector<int>({0, 3, 1, 4, 7}));
+}
+
+TEST(IndexedPriorityQueueTest, RandomizedAgainstSortedReference) {
+    IndexedPriorityQueue<int> pq;
+    std::vector<int> handles;
+    std::vector<int> reference;
+    std::mt19937 rng(123);
+
+    for (int i = 0; i < 2000; i++) {
+        handles.push_back(pq.enqueue(rng() % 10000));
+    }
+    // Update and erase a random subset through their handles
+    for (int i = 0; i < 2000; i++) {
+        if (i % 5 == 0) {
+            pq.erase(handles[i]);
+        } else {
+            int value = rng() % 10000;
+            pq.update(handles[i], value);
+            reference.push_back(value);
+        }
+    }
+
+    std::sort(reference.rbegin(), reference.rend());
+    for (int expected : reference) {
+        ASSERT_EQ(pq.dequeue(), expected);
+    }
+    EXPECT_TRUE(pq.isEmpty());
+}
+
+// RadixHeap Tests
+TEST(RadixHeapTest, PopsInAscendingOrder) {
+    RadixHeap<unsigned int> heap;
+    for (unsigned int value : {50u, 3u, 17u, 3u, 1000000u, 0u, 42u}) {
+        heap.enqueue(value);
+    }
+
+    EXPECT_EQ(heap.size(), 7);
+    EXPECT_EQ(heap.top(), 0u);
+
+    std::vector<unsigned int> order;
+    while (!heap.isEmpty()) {
+        order.push_back(heap.dequeue());
+    }
+    EXPECT_EQ(order, std::vector<unsigned int>({0, 3, 3, 17, 42, 50, 1000000}));
+    EXPECT_THROW(heap.dequeue(), std::underflow_error);
+}
+
+TEST(RadixHeapTest, RejectsKeysBelowLastPopped) {
+    RadixHeap<unsigned int> heap;
+    heap.enqueue(10);
+    heap.enqueue(20);
+    EXPECT_EQ(heap.dequeue(), 10u);
+
+    EXPECT_THROW(heap.enqueue(5), std::invalid_argument);
+    heap.enqueue(10);  // equal to last popped key is fine
+    EXPECT_EQ(heap.dequeue(), 10u);
+}
+
+TEST(RadixHeapTest, PeekDoesNotRaiseTheFloor) {
+    RadixHeap<unsigned int, int> heap;
+    heap.enqueue(40, 1);
+    EXPECT_EQ(heap.dequeue(), 1);
+    heap.enqueue(100, 2);
+    EXPECT_EQ(heap.top(), 2);
+    EXPECT_EQ(heap.topKey(), 100u);
+
+    // Still above the last popped key (40), so accepted after the peek
+    heap.enqueue(50, 3);
+    EXPECT_EQ(heap.topKey(), 50u);
+    heap.enqueue(50, 4);
+    for (int i = 0; i < 2; i++) {
+        int peeked = heap.top();
+        EXPECT_EQ(heap.dequeue(), peeked);
+    }
+    EXPECT_THROW(heap.enqueue(49), std::invalid_argument);
+    EXPECT_EQ(heap.dequeue(), 2);
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+TEST(RadixHeapTest, MonotoneWorkloadWithPayload) {
+    RadixHeap<unsigned long long, int> heap;
+    PriorityQueue<unsigned long long, 4, std::greater<unsigned long long>> reference;
+    std::mt19937 rng(99);
+
+    heap.enqueue(0, 0);
+    reference.enqueue(0);
+    for (int i = 1; i < 20000; i++) {
+        unsigned long long current = heap.topKey();
+        ASSERT_EQ(current, reference.top());
+        heap.dequeue();
+        reference.dequeue();
+
+        // Each pop schedules up to two later events
+        for (int j = 0; j < 2; j++) {
+            unsigned long long key = current + rng() % 5000;
+            heap.enqueue(key, i);
+            reference.enqueue(key);
+        }
+    }
+    while (!reference.isEmpty()) {
+        ASSERT_EQ(heap.topKey(), reference.dequeue());
+        heap.dequeue();
+    }
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+// BucketQueue Tests
+TEST(BucketQueueTest, PopsLowestPriorityFirst) {
+    BucketQueue<std::string> queue(10);
+    queue.enqueue(7, "seven");
+    queue.enqueue(2, "two");
+    queue.enqueue(9, "nine");
+
+    EXPECT_EQ(queue.topPriority(), 2);
+    EXPECT_EQ(queue.dequeue(), "two");
+
+    // Priorities below the cursor are still accepted
+    queue.enqueue(1, "one");
+    EXPECT_EQ(queue.dequeue(), "one");
+    EXPECT_EQ(queue.dequeue(), "seven");
+    EXPECT_EQ(queue.top(), "nine");
+    EXPECT_EQ(queue.size(), 1);
+}
+
+TEST(BucketQueueTest, RangeChecks) {
+    BucketQueue<int> queue(5);
+    EXPECT_THROW(queue.enqueue(6), std::out_of_range);
+    EXPECT_THROW(queue.enqueue(-1), std::out_of_range);
+    EXPECT_THROW(queue.dequeue(), std::underflow_error);
+    EXPECT_THROW(BucketQueue<int>(-1), std::invalid_argument);
+
+    queue.enqueue(5);
+    queue.enqueue(0);
+    EXPECT_EQ(queue.dequeue(), 0);
+    EXPECT_EQ(queue.dequeue(), 5);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/queue.cpp"
+#include "../../assignments/week03-stacks-queues/segmented_queue.cpp"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+// Small blocks so every test crosses many block boundaries
+template<typename T>
+using SmallBlockQueue = SegmentedQueue<T, 4>;
+
+TEST(SegmentedQueueTest, FIFOOrder) {
+    SmallBlockQueue<int> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_THROW(queue.dequeue(), std::underflow_error);
+    EXPECT_THROW(queue.front(), std::underflow_error);
+    EXPECT_THROW(queue.rear(), std::underflow_error);
+
+    for (int i = 1; i <= 10; i++) {
+        queue.enqueue(i);
+        EXPECT_EQ(queue.rear(), i);
+    }
+    EXPECT_EQ(queue.size(), 10);
+    EXPECT_EQ(queue.front(), 1);
+    for (int i = 1; i <= 10; i++) {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(SegmentedQueueTest, InvalidCapacity) {
+    EXPECT_THROW(SmallBlockQueue<int>(0), std::invalid_argument);
+    EXPECT_THROW(SmallBlockQueue<int>(-3), std::invalid_argument);
+}
+
+TEST(SegmentedQueueTest, RandomizedAgainstStdDeque) {
+    SmallBlockQueue<std::string> queue;
+    std::deque<std::string> reference;
+    std::mt19937 rng(40);
+
+    for (int i = 0; i < 50000; i++) {
+        int operation = rng() % 5;
+        if (operation <= 1 || reference.empty()) {
+            std::string value = std::to_string(rng() % 1000);
+            if (operation == 0) {
+                queue.enqueue(value);
+                reference.push_back(value);
+            } else {
+                queue.enqueueFront(value);
+                reference.push_front(value);
+            }
+        } else if (operation == 2) {
+            ASSERT_EQ(queue.front(), reference.front());
+            ASSERT_EQ(queue.dequeue(), reference.front());
+            reference.pop_front();
+        } else if (operation == 3) {
+            ASSERT_EQ(queue.rear(), reference.back());
+            ASSERT_EQ(queue.dequeueRear(), reference.back());
+            reference.pop_back();
+        } else {
+            int k = 1 + rng() % reference.size();
+            queue.reverseFirstK(k);
+            std::reverse(reference.begin(), reference.begin() + k);
+        }
+        ASSERT_EQ(queue.size(), static_cast<int>(reference.size()));
+    }
+
+    SmallBlockQueue<std::string> copy(queue);
+    for (const std::string& expected : reference) {
+        ASSERT_EQ(queue.dequeue(), expected);
+        ASSERT_EQ(copy.dequeue(), expected);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(SegmentedQueueTest, BlocksAreRecycled) {
+    SmallBlockQueue<int> queue(1);
+    EXPECT_EQ(queue.getCapacity(), 4);
+
+    for (int i = 0; i < 100; i++) {
+        queue.enqueue(i);
+    }
+    EXPECT_EQ(queue.getCapacity(), 100);
+
+    // A steady-state producer/consumer needs at most one spare block
+    queue.enqueue(queue.dequeue());
+    int capacity = queue.getCapacity();
+    EXPECT_EQ(capacity, 104);
+    for (int round = 0; round < 1000; round++) {
+        queue.enqueue(queue.dequeue());
+    }
+    EXPECT_EQ(queue.getCapacity(), capacity);
+
+    while (!queue.isEmpty()) {
+        queue.dequeue();
+    }
+    EXPECT_EQ(queue.getCapacity(), capacity);
+    EXPECT_EQ(queue.getFreeBlocks(), capacity / 4 - 1);
+
+    queue.shrinkToFit();
+    EXPECT_EQ(queue.getCapacity(), 4);
+    EXPECT_EQ(queue.getFreeBlocks(), 0);
+}
+
+TEST(SegmentedQueueTest, ClearAndAssignment) {
+    SmallBlockQueue<int> queue;
+    for (int i = 0; i < 37; i++) {
+        queue.enqueue(i);
+    }
+    SmallBlockQueue<int> other;
+    other.enqueue(99);
+    other = queue;
+    EXPECT_EQ(other.size(), 37);
+    EXPECT_EQ(other.front(), 0);
+    EXPECT_EQ(other.rear(), 36);
+
+    int capacity = queue.getCapacity();
+    queue.clear();
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getCapacity(), capacity);
+    queue.enqueue(5);
+    EXPECT_EQ(queue.front(), 5);
+    EXPECT_EQ(other.size(), 37);
+}
+
+TEST(SegmentedQueueTest, ReverseFirstKMatchesQueue) {
+    for (int k = 1; k <= 20; k++) {
+        Queue<int> original;
+        SmallBlockQueue<int> segmented;
+        for (int i = 0; i < 20; i++) {
+            original.enqueue(i);
+            segmented.enqueue(i);
+        }
+        // Offset the head so the prefix starts mid-block
+        original.enqueue(original.dequeue());
+        segmented.enqueue(segmented.dequeue());
+
+        reverseFirstKElements(original, k);
+        reverseFirstKElements(segmented, k);
+        for (int i = 0; i < 20; i++) {
+            ASSERT_EQ(segmented.dequeue(), original.dequeue());
+        }
+    }
+
+    SmallBlockQueue<int> queue;
+    queue.enqueue(1);
+    EXPECT_THROW(queue.reverseFirstK(0), std::invalid_argument);
+    EXPECT_THROW(queue.reverseFirstK(2), std::invalid_argument);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
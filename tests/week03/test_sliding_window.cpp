@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/applications.cpp"
+#include "../../assignments/week03-stacks-queues/sliding_window.cpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Non-commutative monoid: concatenation keeps track of order
+struct ConcatAgg {
+    using value_type = std::string;
+    static std::string identity() { return ""; }
+    static std::string combine(const std::string& a, const std::string& b) { return a + b; }
+};
+
+// Count-Based Window Tests
+TEST(SlidingWindowTest, MatchesSlidingWindowMaximum) {
+    std::vector<int> nums = {1, 3, -1, -3, 5, 3, 6, 7};
+    EXPECT_EQ(slidingWindowAggregate<MaxAgg<int>>(nums, 3), slidingWindowMaximum(nums, 3));
+
+    std::mt19937 rng(5);
+    std::vector<int> random(2000);
+    for (int& value : random) {
+        value = static_cast<int>(rng() % 1000) - 500;
+    }
+    for (int k : {1, 2, 7, 64, 100, 2000}) {
+        EXPECT_EQ(slidingWindowAggregate<MaxAgg<int>>(random, k), slidingWindowMaximum(random, k)) << "k=" << k;
+    }
+}
+
+TEST(SlidingWindowTest, MinAndSumAgainstBruteForce) {
+    std::mt19937 rng(11);
+    const int K = 13;
+    SlidingWindow<MinAgg<int>> minWindow(K);
+    SlidingWindow<SumAgg<long long>> sumWindow(K);
+    std::vector<int> history;
+
+    for (int i = 0; i < 1000; i++) {
+        int value = static_cast<int>(rng() % 10000) - 5000;
+        history.push_back(value);
+        minWindow.push(value);
+        sumWindow.push(value);
+
+        size_t begin = history.size() > K ? history.size() - K : 0;
+        int expectedMin = *std::min_element(history.begin() + begin, history.end());
+        long long expectedSum = std::accumulate(history.begin() + begin, history.end(), 0LL);
+        ASSERT_EQ(minWindow.query(), expectedMin) << "step " << i;
+        ASSERT_EQ(sumWindow.query(), expectedSum) << "step " << i;
+    }
+    EXPECT_EQ(minWindow.size(), K);
+    EXPECT_TRUE(minWindow.isFull());
+}
+
+TEST(SlidingWindowTest, NonCommutativeMonoidKeepsOrder) {
+    SlidingWindow<ConcatAgg> window(3);
+    EXPECT_EQ(window.query(), "");
+
+    for (std::string letter : {"a", "b", "c", "d", "e"}) {
+        window.push(letter);
+    }
+    EXPECT_EQ(window.query(), "cde");
+    EXPECT_EQ(window.pop(), "c");
+    EXPECT_EQ(window.query(), "de");
+    window.push("f");
+    EXPECT_EQ(window.query(), "def");
+    EXPECT_EQ(window.oldest(), "d");
+    EXPECT_EQ(window.newest(), "f");
+}
+
+TEST(SlidingWindowTest, PushManyMatchesSinglePushes) {
+    std::mt19937 rng(3);
+    SlidingWindow<SumAgg<long long>> batched(50);
+    SlidingWindow<SumAgg<long long>> single(50);
+
+    for (int round = 0; round < 40; round++) {
+        std::vector<long long> batch(rng() % 120);
+        for (long long& value : batch) {
+            value = rng() % 100;
+        }
+        batched.pushMany(batch);
+        for (long long value : batch) {
+            single.push(value);
+        }
+        ASSERT_EQ(batched.query(), single.query()) << "round " << round;
+        ASSERT_EQ(batched.size(), single.size());
+    }
+}
+
+TEST(SlidingWindowTest, ErrorHandling) {
+    EXPECT_THROW(SlidingWindow<MaxAgg<int>>(0), std::invalid_argument);
+
+    SlidingWindow<MaxAgg<int>> window(2);
+    EXPECT_THROW(window.pop(), std::underflow_error);
+    EXPECT_THROW(window.oldest(), std::underflow_error);
+    EXPECT_EQ(window.query(), std::numeric_limits<int>::lowest());
+
+    window.pushTimed(10, 1);
+    EXPECT_THROW(window.pushTimed(5, 2), std::invalid_argument);
+    window.pushTimed(10, 2);
+    EXPECT_THROW(window.pushTimed(11, 3), std::overflow_error);
+}
+
+// Time-Based Window Tests
+TEST(TimeWindowTest, ExpiresByTimestamp) {
+    TimeWindow<SumAgg<int>> window(10, 100);
+    window.push(0, 1);
+    window.push(5, 2);
+    window.push(9, 4);
+    EXPECT_EQ(window.query(9), 7);
+
+    window.push(10, 8);  // (0, 10]: the value at t=0 expires
+    EXPECT_EQ(window.query(10), 14);
+    EXPECT_EQ(window.query(15), 12);
+    EXPECT_EQ(window.query(100), 0);
+    EXPECT_TRUE(window.isEmpty());
+}
+
+TEST(TimeWindowTest, MaxOverIrregularArrivals) {
+    std::mt19937 rng(8);
+    const long long DURATION = 50;
+    TimeWindow<MaxAgg<int>> window(DURATION, 1000);
+    std::vector<std::pair<long long, int>> events;
+
+    long long now = 0;
+    for (int i = 0; i < 2000; i++) {
+        now += rng() % 7;
+        int value = static_cast<int>(rng() % 1000);
+        events.push_back({now, value});
+        window.push(now, value);
+
+        int expected = std::numeric_limits<int>::lowest();
+        for (const auto& event : events) {
+            if (event.first > now - DURATION) {
+                expected = std::max(expected, event.second);
+            }
+        }
+        ASSERT_EQ(window.query(now), expected) << "event " << i;
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week03-stacks-queues/work_stealing_deque.cpp"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+class WorkStealingDequeTest : public ::testing::Test {
+protected:
+    WorkStealingDeque<int> deque{4};
+};
+
+// Single-threaded Behaviour Tests
+TEST_F(WorkStealingDequeTest, EmptyDeque) {
+    int value;
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_FALSE(deque.tryPop(value));
+    EXPECT_FALSE(deque.trySteal(value));
+    EXPECT_THROW(deque.pop(), std::underflow_error);
+    EXPECT_EQ(deque.size(), 0);
+}
+
+TEST_F(WorkStealingDequeTest, OwnerPopsLIFO) {
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_EQ(deque.pop(), 2);
+    EXPECT_EQ(deque.pop(), 1);
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+TEST_F(WorkStealingDequeTest, ThiefStealsFIFO) {
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+
+    int value;
+    EXPECT_TRUE(deque.trySteal(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_TRUE(deque.trySteal(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(deque.trySteal(value));
+}
+
+TEST_F(WorkStealingDequeTest, GrowsAndKeepsOrder) {
+    int value;
+    // Advance top first so the live range wraps around the circular array
+    deque.push(-1);
+    deque.push(-2);
+    EXPECT_TRUE(deque.trySteal(value));
+    EXPECT_TRUE(deque.trySteal(value));
+
+    for (int i = 0; i < 100; i++) {
+        deque.push(i);
+    }
+    EXPECT_GE(deque.getCapacity(), 100);
+    EXPECT_EQ(deque.size(), 100);
+
+    for (int i = 0; i < 50; i++) {
+        ASSERT_TRUE(deque.trySteal(value));
+        EXPECT_EQ(value, i);
+    }
+    for (int i = 99; i >= 50; i--) {
+        EXPECT_EQ(deque.pop(), i);
+    }
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+TEST(WorkStealingDequeConstructionTest, InvalidCapacity) {
+    EXPECT_THROW(WorkStealingDeque<int>(0), std::invalid_argument);
+}
+
+// Concurrency Tests
+TEST(WorkStealingDequeConcurrencyTest, EveryTaskRunsExactlyOnce) {
+    const int TASKS = 50000;
+    const int THIEVES = 3;
+
+    WorkStealingDeque<int> deque;
+    std::unique_ptr<std::atomic<int>[]> runCount(new std::atomic<int>[TASKS]);
+    for (int i = 0; i < TASKS; i++) {
+        runCount[i].store(0);
+    }
+    std::atomic<bool> done(false);
+    std::atomic<int> executed(0);
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < THIEVES; t++) {
+        thieves.emplace_back([&]() {
+            int task;
+            while (!done.load()) {
+                if (deque.trySteal(task)) {
+                    runCount[task]++;
+                    executed++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Owner interleaves pushes and pops, growing the array along the way
+    int task;
+    for (int i = 0; i < TASKS; i++) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.tryPop(task)) {
+            runCount[task]++;
+            executed++;
+        }
+    }
+    while (executed.load() < TASKS) {
+        if (deque.tryPop(task)) {
+            runCount[task]++;
+            executed++;
+        }
+    }
+    done.store(true);
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    EXPECT_EQ(executed.load(), TASKS);
+    for (int i = 0; i < TASKS; i++) {
+        ASSERT_EQ(runCount[i].load(), 1) << "task " << i;
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,6 +5,9 @@
 #include <stdexcept>
 #include <random>
 #include <cmath>
+#include <set>
+#include <string>
+#include <iterator>
 
 class AVLTest : public ::testing::Test {
 protected:
@@ -499,6 +502,432 @@ TEST(AVLPerformanceTest, HeightComparison) {
               << ", Worst height: " << expectedWorstHeight << std::endl;
 }
 
+// Iterative vs. recursive operations
+TEST(AVLIterativeTest, MatchesRecursiveShape) {
+    AVLTree<int> iterative;
+    AVLTree<int> recursive;
+    std::mt19937 rng(42);
+    
+    for (int i = 0; i < 20000; i++) {
+        int value = rng() % 3000;
+        if (rng() % 3 == 0) {
+            iterative.remove(value);
+            recursive.removeRecursive(value);
+        } else {
+            iterative.insert(value);
+            recursive.insertRecursive(value);
+        }
+        if (i % 1000 == 0) {
+            ASSERT_EQ(iterative.levelOrderTraversal(), recursive.levelOrderTraversal());
+            ASSERT_TRUE(iterative.isBalanced());
+        }
+    }
+    
+    EXPECT_EQ(iterative.preorderTraversal(), recursive.preorderTraversal());
+    EXPECT_EQ(iterative.inorderTraversal(), recursive.inorderTraversal());
+    EXPECT_EQ(iterative.size(), recursive.size());
+    EXPECT_EQ(iterative.getHeight(), recursive.getHeight());
+    for (int value = 0; value < 3000; value++) {
+        ASSERT_EQ(iterative.contains(value), recursive.containsRecursive(value));
+    }
+}
+
+TEST(AVLIterativeTest, SequentialInsertAndDrain) {
+    const int NUM_ELEMENTS = 200000;
+    AVLTree<int> avl;
+    for (int i = 0; i < NUM_ELEMENTS; i++) {
+        avl.insert(i);
+    }
+    EXPECT_EQ(avl.getHeight(), 17); // Sequential inserts give a near-perfect tree
+    EXPECT_TRUE(avl.isBalanced());
+    
+    for (int i = 0; i < NUM_ELEMENTS; i += 2) {
+        avl.remove(i);
+    }
+    EXPECT_TRUE(avl.isBalanced());
+    EXPECT_EQ(avl.size(), static_cast<size_t>(NUM_ELEMENTS / 2));
+    EXPECT_EQ(avl.findMin(), 1);
+    
+    for (int i = 1; i < NUM_ELEMENTS; i += 2) {
+        avl.remove(i);
+    }
+    EXPECT_TRUE(avl.isEmpty());
+    EXPECT_EQ(avl.getHeight(), -1);
+}
+
+// Bulk loading
+TEST(AVLFromSortedTest, BuildsPerfectlyBalancedTree) {
+    for (int n : {0, 1, 2, 3, 7, 8, 100, 1023, 1024}) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; i++) {
+            keys[i] = 3 * i;
+        }
+        AVLTree<int> avl = AVLTree<int>::fromSorted(keys);
+        EXPECT_EQ(avl.size(), static_cast<size_t>(n));
+        EXPECT_EQ(avl.inorderTraversal(), keys);
+        EXPECT_TRUE(avl.isBalanced());
+        EXPECT_EQ(avl.getHeight(), n == 0 ? -1 : static_cast<int>(std::log2(n)));
+    }
+}
+
+TEST(AVLFromSortedTest, ParallelMatchesSequential) {
+    std::vector<int> keys(300000);
+    for (size_t i = 0; i < keys.size(); i++) {
+        keys[i] = static_cast<int>(2 * i + 1);
+    }
+    AVLTree<int> sequential = AVLTree<int>::fromSorted(keys.begin(), keys.end());
+    AVLTree<int> parallel = AVLTree<int>::fromSorted(keys.begin(), keys.end(), 4);
+    AVLTree<int, HeapAllocator<AVLNode<int>>> heap =
+        AVLTree<int, HeapAllocator<AVLNode<int>>>::fromSorted(keys, 4);
+    
+    EXPECT_EQ(parallel.preorderTraversal(), sequential.preorderTraversal());
+    EXPECT_EQ(heap.preorderTraversal(), sequential.preorderTraversal());
+    EXPECT_EQ(parallel.getHeight(), sequential.getHeight());
+    
+    // The bulk-built tree stays fully mutable
+    for (int i = 0; i < 1000; i++) {
+        parallel.remove(2 * i + 1);
+        parallel.insert(2 * i);
+    }
+    EXPECT_TRUE(parallel.isBalanced());
+    EXPECT_EQ(parallel.size(), keys.size());
+    EXPECT_TRUE(parallel.contains(0));
+    EXPECT_FALSE(parallel.contains(1));
+}
+
+TEST(AVLFromSortedTest, RejectsUnsortedInput) {
+    std::vector<int> unsorted = {1, 3, 2};
+    std::vector<int> duplicates = {1, 2, 2, 3};
+    EXPECT_THROW(AVLTree<int>::fromSorted(unsorted), std::invalid_argument);
+    EXPECT_THROW(AVLTree<int>::fromSorted(duplicates), std::invalid_argument);
+}
+
+TEST(AVLFromSortedTest, MoveSemantics) {
+    std::vector<int> keys = {1, 2, 3, 4, 5};
+    AVLTree<int> source = AVLTree<int>::fromSorted(keys);
+    AVLTree<int> moved(std::move(source));
+    EXPECT_TRUE(source.isEmpty());
+    EXPECT_EQ(moved.inorderTraversal(), keys);
+    
+    AVLTree<int> target;
+    target.insert(42);
+    target = std::move(moved);
+    EXPECT_EQ(target.inorderTraversal(), keys);
+    EXPECT_FALSE(target.contains(42));
+}
+
+// Join-based set operations
+template<typename Tree>
+void expectValidSet(const Tree& tree, const std::set<int>& expected) {
+    std::vector<int> keys(expected.begin(), expected.end());
+    EXPECT_EQ(tree.inorderTraversal(), keys);
+    EXPECT_EQ(tree.size(), expected.size());
+    EXPECT_TRUE(tree.isBalanced());
+    EXPECT_LE(tree.getHeight(), 1.45 * std::log2(expected.size() + 2));
+}
+
+std::set<int> randomSet(std::mt19937& rng, int count, int range) {
+    std::set<int> keys;
+    for (int i = 0; i < count; i++) {
+        keys.insert(static_cast<int>(rng() % range));
+    }
+    return keys;
+}
+
+AVLTree<int> treeOf(const std::set<int>& keys) {
+    AVLTree<int> tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+    return tree;
+}
+
+TEST(AVLSetOperationsTest, MatchStdSetAlgorithms) {
+    std::mt19937 rng(44);
+    const int sizes[][2] = {{0, 50}, {50, 0}, {1, 1000}, {1000, 1}, {300, 300}, {20000, 500}, {40000, 40000}};
+    for (const auto& size : sizes) {
+        for (int threads : {1, 4}) {
+            std::set<int> a = randomSet(rng, size[0], 60000);
+            std::set<int> b = randomSet(rng, size[1], 60000);
+            std::set<int> expectedUnion = a;
+            expectedUnion.insert(b.begin(), b.end());
+            std::set<int> expectedIntersection;
+            std::set<int> expectedDifference;
+            for (int key : a) {
+                (b.count(key) ? expectedIntersection : expectedDifference).insert(key);
+            }
+            
+            AVLTree<int> unionTree = treeOf(a);
+            unionTree.unionWith(treeOf(b), threads);
+            expectValidSet(unionTree, expectedUnion);
+            
+            AVLTree<int> intersectionTree = treeOf(a);
+            intersectionTree.intersectWith(treeOf(b), threads);
+            expectValidSet(intersectionTree, expectedIntersection);
+            
+            AVLTree<int> differenceTree = treeOf(a);
+            AVLTree<int> other = treeOf(b);
+            differenceTree.differenceWith(other, threads);
+            expectValidSet(differenceTree, expectedDifference);
+            EXPECT_EQ(other.size(), b.size()); // lvalue argument is copied
+            
+            // Results stay fully usable
+            unionTree.insert(-1);
+            unionTree.remove(*expectedUnion.rbegin());
+            EXPECT_TRUE(unionTree.isBalanced());
+        }
+    }
+}
+
+TEST(AVLSetOperationsTest, SplitAndJoin) {
+    std::mt19937 rng(7);
+    std::set<int> keys = randomSet(rng, 5000, 100000);
+    std::vector<int> sorted(keys.begin(), keys.end());
+    
+    for (int pivot : {-5, sorted[0], sorted[2500], sorted[2500] + 1, sorted.back(), 200000}) {
+        AVLTree<int> lower = AVLTree<int>::fromSorted(sorted);
+        AVLTree<int> upper = lower.split(pivot);
+        std::set<int> expectedLower(keys.begin(), keys.lower_bound(pivot));
+        std::set<int> expectedUpper(keys.lower_bound(pivot), keys.end());
+        expectValidSet(lower, expectedLower);
+        expectValidSet(upper, expectedUpper);
+        
+        lower.join(std::move(upper));
+        EXPECT_TRUE(upper.isEmpty());
+        expectValidSet(lower, keys);
+    }
+    
+    AVLTree<int> small = treeOf({1, 2, 3});
+    EXPECT_THROW(small.join(treeOf({3, 4})), std::invalid_argument);
+    small.join(AVLTree<int>());
+    EXPECT_EQ(small.size(), 3u);
+    
+    // A rejected join must not take the other tree's nodes
+    AVLTree<int> overlapping = treeOf({3, 4});
+    EXPECT_THROW(small.join(std::move(overlapping)), std::invalid_argument);
+    expectValidSet(overlapping, {3, 4});
+    expectValidSet(small, {1, 2, 3});
+    
+    AVLTree<int> copied = treeOf({4, 5});
+    small.join(copied);
+    expectValidSet(copied, {4, 5});
+    expectValidSet(small, {1, 2, 3, 4, 5});
+}
+
+TEST(AVLSetOperationsTest, SplitHalvesOutliveEachOther) {
+    AVLTree<int> upper;
+    {
+        std::vector<int> sorted(10000);
+        for (int i = 0; i < 10000; i++) {
+            sorted[i] = i;
+        }
+        AVLTree<int> lower = AVLTree<int>::fromSorted(sorted);
+        upper = lower.split(5000);
+    }
+    EXPECT_EQ(upper.size(), 5000u);
+    EXPECT_EQ(upper.findMin(), 5000);
+    for (int i = 0; i < 1000; i++) {
+        upper.insert(20000 + i);
+        upper.remove(5000 + i);
+    }
+    EXPECT_EQ(upper.size(), 5000u);
+    EXPECT_TRUE(upper.isBalanced());
+}
+
+TEST(AVLSetOperationsTest, NonTrivialKeys) {
+    AVLTree<std::string> a;
+    AVLTree<std::string> b;
+    for (int i = 0; i < 2000; i++) {
+        a.insert("key-with-a-long-heap-allocated-suffix-" + std::to_string(i));
+        b.insert("key-with-a-long-heap-allocated-suffix-" + std::to_string(i + 1000));
+    }
+    AVLTree<std::string> u(a);
+    u.unionWith(b, 4);
+    EXPECT_EQ(u.size(), 3000u);
+    AVLTree<std::string> x(a);
+    x.intersectWith(b, 4);
+    EXPECT_EQ(x.size(), 1000u);
+    a.differenceWith(std::move(b));
+    EXPECT_EQ(a.size(), 1000u);
+    EXPECT_TRUE(a.isBalanced());
+}
+
+// Order statistics
+template<typename Tree>
+void expectOrderStatistics(const Tree& tree, const std::set<int>& expected) {
+    std::vector<int> sorted(expected.begin(), expected.end());
+    ASSERT_EQ(tree.size(), sorted.size());
+    for (size_t i = 0; i < sorted.size(); i += 1 + sorted.size() / 50) {
+        EXPECT_EQ(tree.select(i), sorted[i]);
+        EXPECT_EQ(tree.kthSmallest(static_cast<int>(i) + 1), sorted[i]);
+        EXPECT_EQ(tree.rank(sorted[i]), i);
+        EXPECT_EQ(tree.rank(sorted[i] + 1), i + 1);
+    }
+    for (int low : {-10, 0, 250, 999}) {
+        for (int width : {0, 1, 37, 5000}) {
+            auto first = expected.lower_bound(low);
+            auto last = expected.upper_bound(low + width);
+            EXPECT_EQ(tree.countInRange(low, low + width), static_cast<size_t>(std::distance(first, last)));
+        }
+    }
+}
+
+TEST(AVLOrderStatisticsTest, MatchesSortedOrderUnderUpdates) {
+    std::mt19937 rng(45);
+    std::uniform_int_distribution<int> dist(0, 2000);
+    OrderStatisticAVLTree<int> tree;
+    std::set<int> expected;
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < 200; i++) {
+            int key = dist(rng);
+            switch (rng() % 4) {
+                case 0: tree.insert(key); expected.insert(key); break;
+                case 1: tree.insertRecursive(key); expected.insert(key); break;
+                case 2: tree.remove(key); expected.erase(key); break;
+                default: tree.removeRecursive(key); expected.erase(key); break;
+            }
+        }
+        expectOrderStatistics(tree, expected);
+    }
+    EXPECT_EQ(tree.countInRange(100, 50), 0u);
+    EXPECT_THROW(tree.select(tree.size()), std::out_of_range);
+    EXPECT_THROW(tree.kthSmallest(0), std::out_of_range);
+}
+
+TEST(AVLOrderStatisticsTest, KeptThroughBulkAndSetOperations) {
+    std::mt19937 rng(46);
+    std::set<int> a = randomSet(rng, 3000, 6000);
+    std::set<int> b = randomSet(rng, 1500, 6000);
+    auto build = [](const std::set<int>& keys) {
+        return OrderStatisticAVLTree<int>::fromSorted(std::vector<int>(keys.begin(), keys.end()));
+    };
+    
+    OrderStatisticAVLTree<int> tree = build(a);
+    expectOrderStatistics(tree, a);
+    
+    OrderStatisticAVLTree<int> upper = tree.split(3000);
+    expectOrderStatistics(tree, std::set<int>(a.begin(), a.lower_bound(3000)));
+    expectOrderStatistics(upper, std::set<int>(a.lower_bound(3000), a.end()));
+    tree.join(std::move(upper));
+    expectOrderStatistics(tree, a);
+    
+    OrderStatisticAVLTree<int> copy(tree);
+    copy.unionWith(build(b), 4);
+    std::set<int> expectedUnion = a;
+    expectedUnion.insert(b.begin(), b.end());
+    expectOrderStatistics(copy, expectedUnion);
+    
+    tree.intersectWith(build(b));
+    std::set<int> expectedIntersection;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                          std::inserter(expectedIntersection, expectedIntersection.end()));
+    expectOrderStatistics(tree, expectedIntersection);
+}
+
+template<typename Tree>
+void expectIteratorsMatch(const Tree& tree, const std::set<int>& reference, std::mt19937& rng) {
+    std::vector<int> forward(tree.begin(), tree.end());
+    EXPECT_EQ(forward, std::vector<int>(reference.begin(), reference.end()));
+    
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();) {
+        backward.push_back(*--it);
+    }
+    EXPECT_EQ(backward, std::vector<int>(reference.rbegin(), reference.rend()));
+    
+    for (int probe = 0; probe < 50; probe++) {
+        int value = static_cast<int>(rng() % 1200) - 100;
+        auto lower = tree.lower_bound(value);
+        auto upper = tree.upper_bound(value);
+        if (reference.lower_bound(value) == reference.end()) {
+            EXPECT_TRUE(lower == tree.end());
+        } else {
+            ASSERT_TRUE(lower != tree.end());
+            EXPECT_EQ(*lower, *reference.lower_bound(value));
+        }
+        if (reference.upper_bound(value) == reference.end()) {
+            EXPECT_TRUE(upper == tree.end());
+        } else {
+            ASSERT_TRUE(upper != tree.end());
+            EXPECT_EQ(*upper, *reference.upper_bound(value));
+        }
+        
+        int high = value + static_cast<int>(rng() % 200) - 20;
+        std::vector<int> expected;
+        if (!(high < value)) {
+            expected.assign(reference.lower_bound(value), reference.upper_bound(high));
+        }
+        std::vector<int> actual;
+        for (int key : tree.range(value, high)) {
+            actual.push_back(key);
+        }
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(AVLIteratorTest, MatchesStdSetUnderUpdates) {
+    std::mt19937 rng(50);
+    AVLTree<int> tree;
+    std::set<int> reference;
+    expectIteratorsMatch(tree, reference, rng);
+    
+    for (int round = 0; round < 10; round++) {
+        for (int step = 0; step < 200; step++) {
+            int key = static_cast<int>(rng() % 1000);
+            if (rng() % 3 == 0) {
+                tree.remove(key);
+                reference.erase(key);
+            } else {
+                tree.insert(key);
+                reference.insert(key);
+            }
+        }
+        expectIteratorsMatch(tree, reference, rng);
+    }
+}
+
+TEST(AVLIteratorTest, StandardAlgorithmsAndEarlyExit) {
+    AVLTree<int> tree;
+    EXPECT_TRUE(tree.begin() == tree.end());
+    EXPECT_TRUE(tree.range(1, 10).empty());
+    
+    for (int i = 1; i <= 100; i++) {
+        tree.insert(i * 2);
+    }
+    EXPECT_EQ(std::distance(tree.begin(), tree.end()), 100);
+    EXPECT_EQ(*tree.begin(), 2);
+    EXPECT_EQ(*std::prev(tree.end()), 200);
+    EXPECT_TRUE(std::find(tree.begin(), tree.end(), 64) != tree.end());
+    EXPECT_TRUE(std::find(tree.begin(), tree.end(), 65) == tree.end());
+    EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+    EXPECT_TRUE(tree.range(50, 10).empty());
+    EXPECT_TRUE(tree.range(5, 5).empty());
+    
+    // A page of five keys starting after 101
+    std::vector<int> page;
+    for (int key : tree.range(101, 1000)) {
+        if (page.size() == 5) {
+            break;
+        }
+        page.push_back(key);
+    }
+    EXPECT_EQ(page, (std::vector<int>{102, 104, 106, 108, 110}));
+    
+    auto it = tree.lower_bound(150);
+    EXPECT_EQ(*it++, 150);
+    EXPECT_EQ(*it--, 152);
+    EXPECT_EQ(*it, 150);
+    EXPECT_EQ(*--it, 148);
+    
+    AVLTree<std::string> words;
+    for (const char* word : {"pear", "apple", "fig", "kiwi"}) {
+        words.insert(word);
+    }
+    EXPECT_EQ(words.begin()->size(), 5u);
+    EXPECT_EQ(std::vector<std::string>(words.range("b", "l").begin(), words.range("b", "l").end()),
+              (std::vector<std::string>{"fig", "kiwi"}));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -5,6 +5,9 @@
 #include <stdexcept>
 #include <random>
 #include <cmath>
+#include <set>
+#include <string>
+#include <iterator>
 
 class BSTTest : public ::testing::Test {
 protected:
@@ -389,6 +392,208 @@ TEST(BSTTemplateTest, DoubleBST) {
     EXPECT_DOUBLE_EQ(doubleBST.findMax(), 4.47);
 }
 
+// Bulk loading
+TEST(BSTFromSortedTest, BuildsPerfectlyBalancedTree) {
+    for (int n : {0, 1, 2, 5, 31, 32, 1000}) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; i++) {
+            keys[i] = i - 500;
+        }
+        BinarySearchTree<int> bst = BinarySearchTree<int>::fromSorted(keys);
+        EXPECT_EQ(bst.size(), static_cast<size_t>(n));
+        EXPECT_EQ(bst.inorderTraversal(), keys);
+        EXPECT_EQ(bst.getHeight(), n == 0 ? -1 : static_cast<int>(std::log2(n)));
+    }
+}
+
+TEST(BSTFromSortedTest, ParallelMatchesSequential) {
+    std::vector<long long> keys(200000);
+    for (size_t i = 0; i < keys.size(); i++) {
+        keys[i] = static_cast<long long>(i) * 7;
+    }
+    auto sequential = BinarySearchTree<long long>::fromSorted(keys);
+    auto parallel = BinarySearchTree<long long>::fromSorted(keys, 8);
+    EXPECT_EQ(parallel.levelOrderTraversal(), sequential.levelOrderTraversal());
+    
+    parallel.remove(0);
+    parallel.insert(1);
+    EXPECT_EQ(parallel.findMin(), 1);
+    EXPECT_EQ(parallel.size(), keys.size());
+    
+    std::vector<int> unsorted = {2, 1};
+    EXPECT_THROW(BinarySearchTree<int>::fromSorted(unsorted), std::invalid_argument);
+}
+
+// Order statistics
+TEST(BSTOrderStatisticsTest, MatchesSortedOrderUnderUpdates) {
+    std::mt19937 rng(45);
+    std::uniform_int_distribution<int> dist(0, 2000);
+    OrderStatisticBST<int> tree;
+    BinarySearchTree<int> plain;
+    std::vector<int> sorted;
+    for (int i = 0; i < 4000; i++) {
+        int key = dist(rng);
+        auto position = std::lower_bound(sorted.begin(), sorted.end(), key);
+        bool present = position != sorted.end() && *position == key;
+        if (rng() % 3 == 0) {
+            tree.remove(key);
+            plain.remove(key);
+            if (present) sorted.erase(position);
+        } else {
+            tree.insert(key);
+            plain.insert(key);
+            if (!present) sorted.insert(position, key);
+        }
+    }
+    
+    ASSERT_EQ(tree.size(), sorted.size());
+    for (size_t i = 0; i < sorted.size(); i += 7) {
+        EXPECT_EQ(tree.select(i), sorted[i]);
+        EXPECT_EQ(tree.kthSmallest(static_cast<int>(i) + 1), plain.kthSmallest(static_cast<int>(i) + 1));
+        EXPECT_EQ(tree.rank(sorted[i]), i);
+    }
+    auto countInRange = [&](int low, int high) {
+        return static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), high) -
+                                   std::lower_bound(sorted.begin(), sorted.end(), low));
+    };
+    EXPECT_EQ(tree.countInRange(500, 1500), countInRange(500, 1500));
+    EXPECT_EQ(tree.countInRange(-100, 5000), sorted.size());
+    EXPECT_EQ(tree.countInRange(7, 7), countInRange(7, 7));
+    EXPECT_EQ(tree.countInRange(10, 5), 0u);
+    EXPECT_THROW(tree.select(sorted.size()), std::out_of_range);
+    
+    // Copies and bulk loads carry the sizes
+    OrderStatisticBST<int> copy(tree);
+    EXPECT_EQ(copy.select(sorted.size() / 2), sorted[sorted.size() / 2]);
+    OrderStatisticBST<int> loaded = OrderStatisticBST<int>::fromSorted(sorted);
+    EXPECT_EQ(loaded.rank(sorted.back() + 1), sorted.size());
+    EXPECT_EQ(loaded.kthSmallest(3), sorted[2]);
+}
+
+template<typename Tree>
+void expectIteratorsMatch(const Tree& tree, const std::set<int>& reference, std::mt19937& rng) {
+    std::vector<int> forward(tree.begin(), tree.end());
+    EXPECT_EQ(forward, std::vector<int>(reference.begin(), reference.end()));
+    
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();) {
+        backward.push_back(*--it);
+    }
+    EXPECT_EQ(backward, std::vector<int>(reference.rbegin(), reference.rend()));
+    
+    for (int probe = 0; probe < 50; probe++) {
+        int value = static_cast<int>(rng() % 1200) - 100;
+        auto lower = tree.lower_bound(value);
+        auto upper = tree.upper_bound(value);
+        if (reference.lower_bound(value) == reference.end()) {
+            EXPECT_TRUE(lower == tree.end());
+        } else {
+            ASSERT_TRUE(lower != tree.end());
+            EXPECT_EQ(*lower, *reference.lower_bound(value));
+        }
+        if (reference.upper_bound(value) == reference.end()) {
+            EXPECT_TRUE(upper == tree.end());
+        } else {
+            ASSERT_TRUE(upper != tree.end());
+            EXPECT_EQ(*upper, *reference.upper_bound(value));
+        }
+        
+        int high = value + static_cast<int>(rng() % 200) - 20;
+        std::vector<int> expected;
+        if (!(high < value)) {
+            expected.assign(reference.lower_bound(value), reference.upper_bound(high));
+        }
+        std::vector<int> actual;
+        for (int key : tree.range(value, high)) {
+            actual.push_back(key);
+        }
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(BSTIteratorTest, MatchesStdSetUnderUpdates) {
+    std::mt19937 rng(50);
+    BinarySearchTree<int> tree;
+    std::set<int> reference;
+    expectIteratorsMatch(tree, reference, rng);
+    
+    for (int round = 0; round < 10; round++) {
+        for (int step = 0; step < 200; step++) {
+            int key = static_cast<int>(rng() % 1000);
+            if (rng() % 3 == 0) {
+                tree.remove(key);
+                reference.erase(key);
+            } else {
+                tree.insert(key);
+                reference.insert(key);
+            }
+        }
+        expectIteratorsMatch(tree, reference, rng);
+    }
+}
+
+TEST(BSTIteratorTest, StandardAlgorithmsAndEarlyExit) {
+    BinarySearchTree<int> tree;
+    EXPECT_TRUE(tree.begin() == tree.end());
+    EXPECT_TRUE(tree.range(1, 10).empty());
+    
+    for (int i = 1; i <= 100; i++) {
+        tree.insert(i * 2);
+    }
+    EXPECT_EQ(std::distance(tree.begin(), tree.end()), 100);
+    EXPECT_EQ(*tree.begin(), 2);
+    EXPECT_EQ(*std::prev(tree.end()), 200);
+    EXPECT_TRUE(std::find(tree.begin(), tree.end(), 64) != tree.end());
+    EXPECT_TRUE(std::find(tree.begin(), tree.end(), 65) == tree.end());
+    EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+    EXPECT_TRUE(tree.range(50, 10).empty());
+    EXPECT_TRUE(tree.range(5, 5).empty());
+    
+    // A page of five keys starting after 101
+    std::vector<int> page;
+    for (int key : tree.range(101, 1000)) {
+        if (page.size() == 5) {
+            break;
+        }
+        page.push_back(key);
+    }
+    EXPECT_EQ(page, (std::vector<int>{102, 104, 106, 108, 110}));
+    
+    auto it = tree.lower_bound(150);
+    EXPECT_EQ(*it++, 150);
+    EXPECT_EQ(*it--, 152);
+    EXPECT_EQ(*it, 150);
+    EXPECT_EQ(*--it, 148);
+    
+    BinarySearchTree<std::string> words;
+    for (const char* word : {"pear", "apple", "fig", "kiwi"}) {
+        words.insert(word);
+    }
+    EXPECT_EQ(words.begin()->size(), 5u);
+    EXPECT_EQ(std::vector<std::string>(words.range("b", "l").begin(), words.range("b", "l").end()),
+              (std::vector<std::string>{"fig", "kiwi"}));
+}
+
+TEST(BSTIteratorTest, DegenerateChain) {
+    BinarySearchTree<int> tree;
+    for (int i = 0; i < 2000; i++) {
+        tree.insert(i);
+    }
+    std::vector<int> keys(tree.begin(), tree.end());
+    EXPECT_EQ(keys.size(), 2000u);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_EQ(*tree.lower_bound(1500), 1500);
+    EXPECT_EQ(*std::prev(tree.end()), 1999);
+    
+    // Walking back from the deepest key crosses the inline/heap path boundary
+    int expected = 1999;
+    for (auto it = tree.end(); it != tree.begin();) {
+        --it;
+        ASSERT_EQ(*it, expected--);
+    }
+    EXPECT_EQ(expected, -1);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week04-trees/bplus_tree.cpp"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <random>
+#include <set>
+#include <string>
+
+class BPlusTreeTest : public ::testing::Test {
+protected:
+    BPlusTree<int> tree;
+};
+
+TEST_F(BPlusTreeTest, EmptyTree) {
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_EQ(tree.getHeight(), -1);
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_THROW(tree.findMin(), std::runtime_error);
+    EXPECT_THROW(tree.findMax(), std::runtime_error);
+    EXPECT_TRUE(tree.inorderTraversal().empty());
+    EXPECT_TRUE(tree.rangeQuery(0, 10).empty());
+    tree.remove(1);
+    EXPECT_TRUE(tree.isValid());
+}
+
+TEST_F(BPlusTreeTest, InsertContainsAndDuplicates) {
+    for (int i = 0; i < 10000; i++) {
+        tree.insert((i * 7919) % 10000);
+    }
+    tree.insert(42);
+    EXPECT_EQ(tree.size(), 10000u);
+    EXPECT_TRUE(tree.isValid());
+    EXPECT_GT(tree.getHeight(), 0);
+    EXPECT_EQ(tree.findMin(), 0);
+    EXPECT_EQ(tree.findMax(), 9999);
+    for (int i = 0; i < 10000; i++) {
+        EXPECT_TRUE(tree.contains(i));
+    }
+    EXPECT_FALSE(tree.contains(-1));
+    EXPECT_FALSE(tree.contains(10000));
+    
+    std::vector<int> expected(10000);
+    for (int i = 0; i < 10000; i++) {
+        expected[i] = i;
+    }
+    EXPECT_EQ(tree.inorderTraversal(), expected);
+}
+
+TEST_F(BPlusTreeTest, RangeQueryCrossesLeaves) {
+    for (int i = 0; i < 5000; i++) {
+        tree.insert(2 * i);
+    }
+    std::vector<int> range = tree.rangeQuery(101, 1999);
+    ASSERT_EQ(range.size(), 949u);
+    EXPECT_EQ(range.front(), 102);
+    EXPECT_EQ(range.back(), 1998);
+    EXPECT_EQ(tree.rangeQuery(-50, 0), std::vector<int>{0});
+    EXPECT_EQ(tree.rangeQuery(9998, 20000), std::vector<int>{9998});
+    EXPECT_TRUE(tree.rangeQuery(3, 3).empty());
+    EXPECT_TRUE(tree.rangeQuery(100, 50).empty());
+}
+
+// Small nodes force deep trees, so every split / borrow / merge path runs
+template<typename Tree, typename MakeKey>
+void checkAgainstStdSet(MakeKey makeKey, int operations, int keyRange) {
+    std::mt19937 rng(46);
+    Tree tree;
+    std::set<decltype(makeKey(0))> expected;
+    for (int i = 0; i < operations; i++) {
+        auto key = makeKey(static_cast<int>(rng() % keyRange));
+        if (rng() % 5 < 3) {
+            tree.insert(key);
+            expected.insert(key);
+        } else {
+            tree.remove(key);
+            expected.erase(key);
+        }
+        ASSERT_EQ(tree.contains(key), expected.count(key) > 0);
+        if (i % 1000 == 0) {
+            ASSERT_TRUE(tree.isValid());
+        }
+    }
+    ASSERT_TRUE(tree.isValid());
+    EXPECT_EQ(tree.size(), expected.size());
+    EXPECT_EQ(tree.inorderTraversal(), std::vector<decltype(makeKey(0))>(expected.begin(), expected.end()));
+    
+    Tree copy(tree);
+    for (const auto& key : expected) {
+        tree.remove(key);
+    }
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_TRUE(tree.isValid());
+    EXPECT_TRUE(copy.isValid());
+    EXPECT_EQ(copy.size(), expected.size());
+}
+
+TEST(BPlusTreeRandomTest, MatchesStdSetInt) {
+    checkAgainstStdSet<BPlusTree<int, 64>>([](int x) { return x; }, 60000, 3000);
+    checkAgainstStdSet<BPlusTree<int>>([](int x) { return x; }, 60000, 20000);
+}
+
+TEST(BPlusTreeRandomTest, MatchesStdSetOtherKeys) {
+    checkAgainstStdSet<BPlusTree<long long, 128>>([](int x) { return static_cast<long long>(x) << 33; }, 40000, 5000);
+    checkAgainstStdSet<BPlusTree<std::string, 64>>([](int x) { return std::to_string(x); }, 30000, 2000);
+}
+
+TEST(BPlusTreeSemanticsTest, CopyAndMove) {
+    BPlusTree<int> a;
+    for (int i = 0; i < 1000; i++) {
+        a.insert(i);
+    }
+    BPlusTree<int> b(a);
+    b.remove(0);
+    EXPECT_TRUE(a.contains(0));
+    EXPECT_EQ(b.findMin(), 1);
+    
+    BPlusTree<int> c(std::move(b));
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(c.size(), 999u);
+    
+    c = a;
+    EXPECT_EQ(c.inorderTraversal(), a.inorderTraversal());
+    a = std::move(c);
+    EXPECT_TRUE(a.isValid());
+    EXPECT_EQ(a.size(), 1000u);
+    a.makeEmpty();
+    EXPECT_TRUE(a.isEmpty());
+    a.insert(5);
+    EXPECT_EQ(a.findMax(), 5);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week04-trees/concurrent_bst.cpp"
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <atomic>
+
+TEST(ConcurrentBSTTest, BasicOperations) {
+    ConcurrentBST<int> tree;
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_FALSE(tree.remove(1));
+    EXPECT_TRUE(tree.inorderTraversal().empty());
+    
+    for (int i = 1; i <= 1000; i++) {
+        EXPECT_TRUE(tree.insert((i * 37) % 1000 + 1));
+    }
+    EXPECT_FALSE(tree.insert(500));
+    EXPECT_EQ(tree.size(), 1000u);
+    EXPECT_TRUE(tree.contains(1));
+    EXPECT_TRUE(tree.contains(1000));
+    EXPECT_FALSE(tree.contains(0));
+    EXPECT_EQ(tree.rangeQuery(10, 14), (std::vector<int>{10, 11, 12, 13, 14}));
+    EXPECT_TRUE(tree.rangeQuery(14, 10).empty());
+    EXPECT_EQ(tree.rangeQuery(995, 5000), (std::vector<int>{995, 996, 997, 998, 999, 1000}));
+    
+    EXPECT_TRUE(tree.remove(1));
+    EXPECT_FALSE(tree.remove(1));
+    EXPECT_FALSE(tree.remove(5000));
+    EXPECT_EQ(tree.size(), 999u);
+    EXPECT_FALSE(tree.contains(1));
+    std::vector<int> all = tree.inorderTraversal();
+    EXPECT_EQ(all.size(), 999u);
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end()));
+    EXPECT_EQ(all.front(), 2);
+}
+
+TEST(ConcurrentBSTTest, MatchesStdSetSequentially) {
+    std::mt19937 rng(49);
+    ConcurrentBST<std::string> tree;
+    std::set<std::string> reference;
+    
+    for (int step = 0; step < 20000; step++) {
+        std::string key = std::to_string(rng() % 2000);
+        if (rng() % 2 == 0) {
+            EXPECT_EQ(tree.insert(key), reference.insert(key).second);
+        } else {
+            EXPECT_EQ(tree.remove(key), reference.erase(key) == 1);
+        }
+    }
+    EXPECT_EQ(tree.size(), reference.size());
+    EXPECT_EQ(tree.inorderTraversal(), std::vector<std::string>(reference.begin(), reference.end()));
+    EXPECT_EQ(tree.rangeQuery("3", "4"),
+              std::vector<std::string>(reference.lower_bound("3"), reference.upper_bound("4")));
+    for (int key = 0; key < 2000; key++) {
+        EXPECT_EQ(tree.contains(std::to_string(key)), reference.count(std::to_string(key)) == 1);
+    }
+}
+
+TEST(ConcurrentBSTTest, DisjointWritersKeepEveryUpdate) {
+    ConcurrentBST<int> tree;
+    const int THREADS = 8;
+    const int PER_THREAD = 5000;
+    
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; t++) {
+        writers.emplace_back([&tree, t]() {
+            std::mt19937 rng(t);
+            std::vector<int> keys;
+            for (int i = 0; i < PER_THREAD; i++) {
+                keys.push_back(i * THREADS + t);
+            }
+            std::shuffle(keys.begin(), keys.end(), rng);
+            for (int key : keys) {
+                EXPECT_TRUE(tree.insert(key));
+            }
+            for (int key : keys) {
+                if (key % 3 == 0) {
+                    EXPECT_TRUE(tree.remove(key));
+                }
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    
+    std::vector<int> expected;
+    for (int key = 0; key < THREADS * PER_THREAD; key++) {
+        if (key % 3 != 0) {
+            expected.push_back(key);
+        }
+    }
+    EXPECT_EQ(tree.inorderTraversal(), expected);
+    EXPECT_EQ(tree.size(), expected.size());
+}
+
+TEST(ConcurrentBSTTest, ContendedKeysBalanceOut) {
+    ConcurrentBST<int> tree;
+    const int THREADS = 8;
+    const int KEYS = 64;
+    std::vector<std::atomic<int>> net(KEYS);
+    
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; t++) {
+        workers.emplace_back([&tree, &net, t]() {
+            std::mt19937 rng(100 + t);
+            for (int step = 0; step < 20000; step++) {
+                int key = static_cast<int>(rng() % KEYS);
+                if (rng() % 2 == 0) {
+                    if (tree.insert(key)) {
+                        net[key]++;
+                    }
+                } else if (tree.remove(key)) {
+                    net[key]--;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    
+    // Successful inserts and removes of a key must alternate
+    for (int key = 0; key < KEYS; key++) {
+        ASSERT_GE(net[key].load(), 0);
+        ASSERT_LE(net[key].load(), 1);
+        EXPECT_EQ(tree.contains(key), net[key].load() == 1);
+    }
+}
+
+TEST(ConcurrentBSTTest, RangeQueriesSeeOneInstant) {
+    // The writer slides a window of consecutive keys to the right, so the
+    // tree always holds one run of consecutive keys; a scan that mixed two
+    // instants would see a gap or a run of the wrong length
+    ConcurrentBST<int> tree;
+    const int WINDOW = 200;
+    const int STEPS = 20000;
+    for (int key = 0; key < WINDOW; key++) {
+        tree.insert(key);
+    }
+    
+    std::atomic<bool> done(false);
+    std::thread writer([&]() {
+        for (int low = 0; low < STEPS; low++) {
+            tree.insert(low + WINDOW);
+            tree.remove(low);
+        }
+        done = true;
+    });
+    
+    std::vector<std::thread> readers;
+    std::atomic<int> scans(0);
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&]() {
+            while (!done) {
+                std::vector<int> keys = tree.inorderTraversal();
+                ASSERT_GE(keys.size(), static_cast<size_t>(WINDOW));
+                ASSERT_LE(keys.size(), static_cast<size_t>(WINDOW + 1));
+                for (size_t i = 1; i < keys.size(); i++) {
+                    ASSERT_EQ(keys[i], keys[i - 1] + 1);
+                }
+                int low = keys.front() + WINDOW / 4;
+                std::vector<int> part = tree.rangeQuery(low, low + WINDOW / 2);
+                for (size_t i = 1; i < part.size(); i++) {
+                    ASSERT_EQ(part[i], part[i - 1] + 1);
+                }
+                scans++;
+            }
+        });
+    }
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    
+    EXPECT_GT(scans.load(), 0);
+    std::vector<int> expected;
+    for (int key = STEPS; key < STEPS + WINDOW; key++) {
+        expected.push_back(key);
+    }
+    EXPECT_EQ(tree.inorderTraversal(), expected);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week04-trees/avl_tree.cpp"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <random>
+#include <set>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+TEST(FrozenTreeTest, EmptySnapshot) {
+    AVLTree<int> tree;
+    FrozenTree<int> frozen = tree.freeze();
+    EXPECT_TRUE(frozen.isEmpty());
+    EXPECT_FALSE(frozen.contains(0));
+    EXPECT_TRUE(frozen.rangeQuery(-5, 5).empty());
+    EXPECT_THROW(frozen.findMin(), std::runtime_error);
+    EXPECT_THROW(frozen.findMax(), std::runtime_error);
+    EXPECT_THROW(frozen.kthSmallest(1), std::out_of_range);
+}
+
+TEST(FrozenTreeTest, MatchesTreeForEverySize) {
+    std::mt19937 rng(47);
+    // Sizes around powers of two exercise full and partial last levels
+    for (int n : {1, 2, 3, 7, 8, 9, 31, 32, 33, 100, 1023, 1024, 1025}) {
+        AVLTree<int> tree;
+        std::set<int> keys;
+        while (static_cast<int>(keys.size()) < n) {
+            int key = static_cast<int>(rng() % (4 * n));
+            tree.insert(key);
+            keys.insert(key);
+        }
+        FrozenTree<int> frozen = tree.freeze();
+        std::vector<int> sorted(keys.begin(), keys.end());
+        
+        ASSERT_EQ(frozen.size(), sorted.size());
+        EXPECT_EQ(frozen.findMin(), sorted.front());
+        EXPECT_EQ(frozen.findMax(), sorted.back());
+        for (int key = -1; key <= 4 * n; key++) {
+            ASSERT_EQ(frozen.contains(key), keys.count(key) > 0) << "n=" << n << " key=" << key;
+        }
+        for (size_t k = 1; k <= sorted.size(); k++) {
+            ASSERT_EQ(frozen.kthSmallest(k), sorted[k - 1]);
+        }
+        EXPECT_THROW(frozen.kthSmallest(sorted.size() + 1), std::out_of_range);
+        for (int low = -2; low <= 4 * n; low += 1 + n / 8) {
+            int high = low + n / 3;
+            EXPECT_EQ(frozen.rangeQuery(low, high),
+                      std::vector<int>(keys.lower_bound(low), keys.upper_bound(high)));
+        }
+        EXPECT_TRUE(frozen.rangeQuery(5, 4).empty());
+    }
+}
+
+TEST(FrozenTreeTest, SnapshotIsIndependentOfTree) {
+    AVLTree<int> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i);
+    }
+    FrozenTree<int> frozen = tree.freeze();
+    tree.remove(50);
+    tree.insert(500);
+    EXPECT_TRUE(frozen.contains(50));
+    EXPECT_FALSE(frozen.contains(500));
+    
+    FrozenTree<int> moved(std::move(frozen));
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_TRUE(frozen.isEmpty());
+    
+    std::vector<int> unsorted = {3, 1, 2};
+    EXPECT_THROW(FrozenTree<int>{unsorted}, std::invalid_argument);
+}
+
+TEST(FrozenTreeTest, SaveAndMap) {
+    AVLTree<double> tree;
+    for (int i = 0; i < 5000; i++) {
+        tree.insert(i * 0.5);
+    }
+    std::string path = ::testing::TempDir() + "frozen_tree_test.bin";
+    {
+        FrozenTree<double> frozen = tree.freeze();
+        frozen.save(path);
+    }
+    
+    FrozenTree<double> mapped = FrozenTree<double>::load(path);
+    EXPECT_TRUE(mapped.isMapped());
+    EXPECT_EQ(mapped.size(), 5000u);
+    EXPECT_TRUE(mapped.contains(1234.5));
+    EXPECT_FALSE(mapped.contains(1234.25));
+    EXPECT_EQ(mapped.kthSmallest(11), 5.0);
+    EXPECT_EQ(mapped.rangeQuery(10.0, 12.0), (std::vector<double>{10.0, 10.5, 11.0, 11.5, 12.0}));
+    
+    // Key size is recorded in the header
+    EXPECT_THROW(FrozenTree<int>::load(path), std::runtime_error);
+    EXPECT_THROW(FrozenTree<double>::load(path + ".missing"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(FrozenTreeTest, RejectsCountThatWrapsTheSizeCheck) {
+    // 2^61 + 1 doubles is 2^64 + 8 bytes, which wraps to 8: exactly the
+    // one key actually in the file
+    std::string path = ::testing::TempDir() + "frozen_tree_wrap.bin";
+    char header[32] = {'E', 'Y', 'T', 'Z', 'T', 'R', 'E', 'E'};
+    uint64_t keyBytes = sizeof(double);
+    uint64_t count = (1ull << 61) + 1;
+    std::memcpy(header + 8, &keyBytes, sizeof(keyBytes));
+    std::memcpy(header + 16, &count, sizeof(count));
+    double key = 1.0;
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(header, sizeof(header));
+        out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    }
+    
+    EXPECT_THROW(FrozenTree<double>::load(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week04-trees/binary_search_tree.cpp"
+#include "../../assignments/week04-trees/avl_tree.cpp"
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(SlabArenaTest, RecyclesDestroyedNodes) {
+    SlabArena<TreeNode<int>> arena;
+    TreeNode<int>* first = arena.create(1);
+    TreeNode<int>* second = arena.create(2);
+    EXPECT_EQ(second, first + 1);
+    EXPECT_EQ(arena.chunkCount(), 1u);
+
+    arena.destroy(first);
+    TreeNode<int>* reused = arena.create(3);
+    EXPECT_EQ(reused, first);
+    EXPECT_EQ(reused->data, 3);
+
+    for (int i = 0; i < 1000; i++) {
+        arena.create(i);
+    }
+    EXPECT_GT(arena.chunkCount(), 1u);
+    arena.releaseAll();
+    EXPECT_EQ(arena.chunkCount(), 0u);
+}
+
+TEST(SlabArenaTest, BulkReleaseOnlyForTrivialNodes) {
+    EXPECT_TRUE(SlabArena<TreeNode<int>>::BULK_RELEASE);
+    EXPECT_TRUE(SlabArena<AVLNode<double>>::BULK_RELEASE);
+    EXPECT_FALSE(SlabArena<TreeNode<std::string>>::BULK_RELEASE);
+    EXPECT_FALSE(HeapAllocator<TreeNode<int>>::BULK_RELEASE);
+}
+
+template<typename Tree>
+void runRandomOperations(Tree& tree, std::set<int>& reference, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int i = 0; i < 20000; i++) {
+        int value = rng() % 2000;
+        if (rng() % 3 == 0) {
+            tree.remove(value);
+            reference.erase(value);
+        } else {
+            tree.insert(value);
+            reference.insert(value);
+        }
+    }
+}
+
+TEST(NodeAllocatorTest, ArenaAndHeapTreesAgree) {
+    BinarySearchTree<int> arenaBST;
+    BinarySearchTree<int, HeapAllocator<TreeNode<int>>> heapBST;
+    AVLTree<int> arenaAVL;
+    AVLTree<int, HeapAllocator<AVLNode<int>>> heapAVL;
+    std::set<int> reference;
+    std::set<int> unused;
+
+    runRandomOperations(arenaBST, reference, 41);
+    runRandomOperations(heapBST, unused, 41);
+    unused.clear();
+    runRandomOperations(arenaAVL, unused, 41);
+    unused.clear();
+    runRandomOperations(heapAVL, unused, 41);
+
+    std::vector<int> expected(reference.begin(), reference.end());
+    EXPECT_EQ(arenaBST.inorderTraversal(), expected);
+    EXPECT_EQ(heapBST.inorderTraversal(), expected);
+    EXPECT_EQ(arenaAVL.inorderTraversal(), expected);
+    EXPECT_EQ(heapAVL.inorderTraversal(), expected);
+    EXPECT_TRUE(arenaAVL.isBalanced());
+    EXPECT_EQ(arenaBST.size(), expected.size());
+    EXPECT_EQ(arenaAVL.size(), expected.size());
+}
+
+TEST(NodeAllocatorTest, CopyCompactAndMakeEmpty) {
+    AVLTree<int> avl;
+    BinarySearchTree<int> bst;
+    std::set<int> reference;
+    std::set<int> unused;
+    runRandomOperations(avl, reference, 7);
+    runRandomOperations(bst, unused, 7);
+    std::vector<int> expected(reference.begin(), reference.end());
+
+    AVLTree<int> avlCopy(avl);
+    BinarySearchTree<int> bstCopy;
+    bstCopy = bst;
+    avl.compact();
+    bst.compact();
+    EXPECT_EQ(avl.inorderTraversal(), expected);
+    EXPECT_EQ(avl.levelOrderTraversal(), avlCopy.levelOrderTraversal());
+    EXPECT_EQ(avl.getHeight(), avlCopy.getHeight());
+    EXPECT_TRUE(avl.isBalanced());
+    EXPECT_EQ(bst.levelOrderTraversal(), bstCopy.levelOrderTraversal());
+
+    avl.makeEmpty();
+    bst.makeEmpty();
+    EXPECT_TRUE(avl.isEmpty());
+    EXPECT_TRUE(bst.isEmpty());
+    avl.insert(5);
+    bst.insert(5);
+    EXPECT_TRUE(avl.contains(5));
+    EXPECT_TRUE(bst.contains(5));
+    EXPECT_EQ(avlCopy.inorderTraversal(), expected);
+}
+
+TEST(NodeAllocatorTest, NonTrivialKeys) {
+    AVLTree<std::string> avl;
+    BinarySearchTree<std::string> bst;
+    for (int i = 0; i < 500; i++) {
+        std::string key = "key-with-a-long-heap-allocated-suffix-" + std::to_string(i);
+        avl.insert(key);
+        bst.insert(key);
+    }
+    for (int i = 0; i < 500; i += 2) {
+        std::string key = "key-with-a-long-heap-allocated-suffix-" + std::to_string(i);
+        avl.remove(key);
+        bst.remove(key);
+    }
+    EXPECT_EQ(avl.size(), 250u);
+    EXPECT_EQ(avl.inorderTraversal(), bst.inorderTraversal());
+    avl.makeEmpty();
+    bst.makeEmpty();
+    EXPECT_EQ(avl.size(), 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "../../assignments/week04-trees/persistent_avl_tree.cpp"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <mutex>
+
+TEST(PersistentAVLTest, BasicOperations) {
+    PersistentAVLTree<int> tree;
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_THROW(tree.findMin(), std::runtime_error);
+    EXPECT_THROW(tree.findMax(), std::runtime_error);
+    
+    for (int i = 1; i <= 1000; i++) {
+        tree.insert(i);
+    }
+    tree.insert(500);
+    EXPECT_EQ(tree.size(), 1000u);
+    EXPECT_TRUE(tree.isBalanced());
+    EXPECT_LE(tree.getHeight(), 14);
+    EXPECT_EQ(tree.findMin(), 1);
+    EXPECT_EQ(tree.findMax(), 1000);
+    EXPECT_EQ(tree.rangeQuery(10, 14), (std::vector<int>{10, 11, 12, 13, 14}));
+    
+    tree.remove(1);
+    tree.remove(5000);
+    EXPECT_EQ(tree.size(), 999u);
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_EQ(tree.findMin(), 2);
+}
+
+TEST(PersistentAVLTest, EverySnapshotKeepsItsVersion) {
+    std::mt19937 rng(48);
+    PersistentAVLTree<int> tree;
+    std::set<int> keys;
+    std::vector<PersistentAVLTree<int>> snapshots;
+    std::vector<std::set<int>> expected;
+    
+    for (int i = 0; i < 20000; i++) {
+        int key = static_cast<int>(rng() % 2000);
+        if (rng() % 3 != 0) {
+            tree.insert(key);
+            keys.insert(key);
+        } else {
+            tree.remove(key);
+            keys.erase(key);
+        }
+        if (i % 400 == 0) {
+            snapshots.push_back(tree.snapshot());
+            expected.push_back(keys);
+        }
+    }
+    
+    for (size_t v = 0; v < snapshots.size(); v++) {
+        const std::set<int>& version = expected[v];
+        ASSERT_EQ(snapshots[v].size(), version.size());
+        EXPECT_TRUE(snapshots[v].isBalanced());
+        EXPECT_EQ(snapshots[v].inorderTraversal(), std::vector<int>(version.begin(), version.end()));
+        EXPECT_EQ(snapshots[v].rangeQuery(500, 700),
+                  std::vector<int>(version.lower_bound(500), version.upper_bound(700)));
+    }
+    
+    // Snapshots are trees in their own right and may branch
+    PersistentAVLTree<int> branch = snapshots[10];
+    EXPECT_TRUE(branch.sharesRootWith(snapshots[10]));
+    branch.insert(-1);
+    EXPECT_FALSE(branch.sharesRootWith(snapshots[10]));
+    EXPECT_FALSE(snapshots[10].contains(-1));
+    EXPECT_EQ(branch.size(), expected[10].size() + 1);
+}
+
+TEST(PersistentAVLTest, NoOpUpdatesDoNotCopy) {
+    PersistentAVLTree<int> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i);
+    }
+    PersistentAVLTree<int> snapshot = tree.snapshot();
+    tree.insert(50);
+    tree.remove(1000);
+    EXPECT_TRUE(tree.sharesRootWith(snapshot));
+}
+
+TEST(PersistentAVLTest, NonTrivialKeysAndAssignment) {
+    PersistentAVLTree<std::string> a;
+    for (int i = 0; i < 500; i++) {
+        a.insert("key-with-a-long-heap-allocated-suffix-" + std::to_string(i));
+    }
+    PersistentAVLTree<std::string> b = a;
+    b.remove("key-with-a-long-heap-allocated-suffix-7");
+    a = b;
+    a = a;
+    EXPECT_EQ(a.size(), 499u);
+    PersistentAVLTree<std::string> c(std::move(b));
+    EXPECT_TRUE(b.isEmpty());
+    a.makeEmpty();
+    EXPECT_EQ(c.size(), 499u);
+    EXPECT_TRUE(c.isBalanced());
+}
+
+TEST(PersistentAVLTest, ReadersRunAlongsideWriter) {
+    std::mutex slotLock; // guards only the hand-over slot, never a query
+    PersistentAVLTree<int> published;
+    bool done = false;
+    
+    std::thread writer([&]() {
+        PersistentAVLTree<int> tree;
+        for (int i = 0; i < 50000; i++) {
+            tree.insert(i);
+            if (i % 3 == 0) {
+                tree.remove(i / 2);
+            }
+            if (i % 64 == 0) {
+                PersistentAVLTree<int> snapshot = tree.snapshot();
+                std::lock_guard<std::mutex> guard(slotLock);
+                std::swap(published, snapshot);
+            }
+        }
+        std::lock_guard<std::mutex> guard(slotLock);
+        done = true;
+    });
+    
+    std::vector<std::thread> readers;
+    std::vector<int> failures(3, 0);
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&, r]() {
+            while (true) {
+                PersistentAVLTree<int> snapshot;
+                {
+                    std::lock_guard<std::mutex> guard(slotLock);
+                    if (done) {
+                        return;
+                    }
+                    snapshot = published;
+                }
+                std::vector<int> keys = snapshot.inorderTraversal();
+                if (keys.size() != snapshot.size() || !std::is_sorted(keys.begin(), keys.end())) {
+                    failures[r]++;
+                }
+            }
+        });
+    }
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures, std::vector<int>(3, 0));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}